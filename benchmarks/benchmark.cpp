@@ -2,6 +2,7 @@
 #include <Storm/Storm.hpp>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <charconv>
 #include <chrono>
@@ -13,6 +14,8 @@
 #include <iostream>
 #include <limits>
 #include <random>
+#include <sstream>
+#include <span>
 #include <string>
 #include <string_view>
 #include <system_error>
@@ -24,6 +27,8 @@ namespace {
 constexpr std::uint64_t seed = 0x5A17'2026'0715'0001ULL;
 constexpr std::size_t bound = 1'000;
 constexpr std::size_t default_iterations = 2'000'000;
+constexpr std::size_t fill_block = 1'024;
+constexpr std::size_t linear_reference_limit = 1'000;
 
 template<typename Value>
 auto checksum_value(const Value value) -> std::uint64_t {
@@ -66,12 +71,105 @@ auto run_case(const std::string_view label,
     const auto elapsed = std::chrono::duration<double, std::nano>{stop - start}.count();
     const auto nanoseconds_per_unit = elapsed / static_cast<double>(iterations);
 
-    std::cout << std::left << std::setw(38) << label << std::right << std::fixed
+    std::cout << std::left << std::setw(48) << label << std::right << std::fixed
               << std::setprecision(2) << std::setw(12) << nanoseconds_per_unit
               << " ns/" << unit << "  checksum=" << checksum << '\n';
     return checksum;
 }
 
+template<typename Value, typename Fill>
+auto consume_fill(const std::size_t iterations, std::vector<Value>& buffer, Fill& fill)
+    -> std::uint64_t {
+    std::uint64_t checksum = 0;
+    for (std::size_t offset = 0; offset < iterations; offset += buffer.size()) {
+        const std::size_t length = std::min(buffer.size(), iterations - offset);
+        const std::span<Value> block{buffer.data(), length};
+        fill(block);
+        for (std::size_t index = 0; index < length; ++index) {
+            checksum ^= mix(checksum_value(block[index]) +
+                            static_cast<std::uint64_t>(offset + index));
+        }
+    }
+    return checksum;
+}
+
+template<typename Value, typename Fill>
+auto run_fill_case(const std::string_view label,
+                   const std::size_t iterations,
+                   std::vector<Value>& buffer,
+                   Fill& fill) -> std::uint64_t {
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t checksum = consume_fill(iterations, buffer, fill);
+    const auto stop = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double, std::nano>{stop - start}.count();
+
+    std::cout << std::left << std::setw(48) << label << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12)
+              << elapsed / static_cast<double>(iterations) << " ns/draw  checksum="
+              << checksum << '\n';
+    return checksum;
+}
+
+auto fill_benchmark(const std::size_t size,
+                    const std::size_t iterations,
+                    const std::size_t warmup_iterations,
+                    std::uint64_t& warmup_checksum) -> std::uint64_t {
+    std::vector<std::size_t> buffer(fill_block);
+
+    Storm::Generator scalar_generator{seed};
+    auto scalar_fill = [&scalar_generator, size](const std::span<std::size_t> block) {
+        for (std::size_t& value : block) {
+            value = Storm::uniform_index(scalar_generator.engine(), size);
+        }
+    };
+    warmup_checksum ^= consume_fill(warmup_iterations, buffer, scalar_fill);
+    const std::string scalar_label = "uniform_index loop (bound " + std::to_string(size) + ")";
+    const auto scalar_checksum = run_fill_case(scalar_label, iterations, buffer, scalar_fill);
+
+    Storm::Generator bulk_generator{seed};
+    auto bulk_fill = [&bulk_generator, size](const std::span<std::size_t> block) {
+        Storm::uniform_index(bulk_generator.engine(), size, block);
+    };
+    warmup_checksum ^= consume_fill(warmup_iterations, buffer, bulk_fill);
+    const std::string bulk_label = "uniform_index fill (bound " + std::to_string(size) + ")";
+    const auto bulk_checksum = run_fill_case(bulk_label, iterations, buffer, bulk_fill);
+
+    return scalar_checksum ^ mix(bulk_checksum + static_cast<std::uint64_t>(size));
+}
+
+auto mapping_label(const std::string_view mapping, const std::uint64_t mapped_bound)
+    -> std::string {
+    std::ostringstream label;
+    label << mapping << " (bound 0x" << std::hex << mapped_bound << ')';
+    return label.str();
+}
+
+auto mapping_benchmark(const std::uint64_t mapped_bound,
+                       const std::size_t iterations,
+                       const std::size_t warmup_iterations,
+                       std::uint64_t& warmup_checksum) -> std::uint64_t {
+    const std::uint64_t high = mapped_bound - 1U;
+
+    Storm::Generator modulo_generator{seed};
+    auto modulo_draw = [&modulo_generator, high] {
+        return Storm::uniform_unsigned(modulo_generator.engine(), std::uint64_t{0}, high);
+    };
+    warmup_checksum ^= warm_up(warmup_iterations, modulo_draw);
+    const auto modulo_checksum = run_case(
+        mapping_label("modulo", mapped_bound), "draw", iterations, modulo_draw);
+
+    Storm::Generator multiply_generator{seed};
+    auto multiply_draw = [&multiply_generator, high] {
+        return Storm::uniform_unsigned(multiply_generator.engine(), std::uint64_t{0}, high,
+                                       Storm::nearly_divisionless_mapping);
+    };
+    warmup_checksum ^= warm_up(warmup_iterations, multiply_draw);
+    const auto multiply_checksum = run_case(
+        mapping_label("divisionless", mapped_bound), "draw", iterations, multiply_draw);
+
+    return modulo_checksum ^ mix(multiply_checksum + mapped_bound);
+}
+
 auto parse_iterations(const int argc, char* argv[]) -> std::size_t {
     if (argc == 1) {
         return default_iterations;
@@ -144,6 +242,82 @@ auto weighted_benchmark(const std::size_t size,
     const auto prepared_checksum =
         run_case(prepared_label, "draw", iterations, prepared_draw);
 
+    std::vector<std::size_t> buffer(fill_block);
+    Storm::Generator batch_generator{seed};
+    auto batch_fill = [&prepared, &batch_generator](const std::span<std::size_t> block) {
+        prepared.select_many(batch_generator.engine(), block);
+    };
+    warmup_checksum ^= consume_fill(warmup_iterations, buffer, batch_fill);
+    const std::string batch_label =
+        "PreparedWeightedIndex select_many (" + std::to_string(size) + " entries)";
+    const auto batch_checksum = run_fill_case(batch_label, iterations, buffer, batch_fill);
+
+    const Storm::PreparedWeightedIndex eytzinger{weights, Storm::cumulative_layout::eytzinger};
+    Storm::Generator eytzinger_generator{seed};
+    auto eytzinger_draw = [&eytzinger, &eytzinger_generator] {
+        return eytzinger(eytzinger_generator.engine());
+    };
+    warmup_checksum ^= mix(warm_up(warmup_iterations, eytzinger_draw) +
+                           static_cast<std::uint64_t>(size * 4U));
+    const std::string eytzinger_label =
+        "PreparedWeightedIndex eytzinger (" + std::to_string(size) + " entries)";
+    const auto eytzinger_checksum =
+        run_case(eytzinger_label, "draw", iterations, eytzinger_draw);
+
+    const Storm::PreparedWeightedIndex guided{weights, Storm::guide_table{size}};
+    Storm::Generator guided_generator{seed};
+    auto guided_draw = [&guided, &guided_generator] {
+        return guided(guided_generator.engine());
+    };
+    warmup_checksum ^= mix(warm_up(warmup_iterations, guided_draw) +
+                           static_cast<std::uint64_t>(size * 5U));
+    const std::string guided_label =
+        "PreparedWeightedIndex guided (" + std::to_string(size) + " entries)";
+    const auto guided_checksum = run_case(guided_label, "draw", iterations, guided_draw);
+
+    const Storm::PreparedAliasWeightedIndex alias{weights};
+    Storm::Generator alias_generator{seed};
+    auto alias_draw = [&alias, &alias_generator] { return alias(alias_generator.engine()); };
+    warmup_checksum ^= mix(warm_up(warmup_iterations, alias_draw) +
+                           static_cast<std::uint64_t>(size * 3U));
+    const std::string alias_label =
+        "PreparedAliasWeightedIndex (" + std::to_string(size) + " entries)";
+    const auto alias_checksum = run_case(alias_label, "draw", iterations, alias_draw);
+    Storm::DynamicWeightedIndex dynamic{weights};
+    Storm::Generator dynamic_generator{seed};
+    auto dynamic_draw = [&dynamic, &dynamic_generator] {
+        return dynamic(dynamic_generator.engine());
+    };
+    warmup_checksum ^= mix(warm_up(warmup_iterations, dynamic_draw) +
+                           static_cast<std::uint64_t>(size * 6U));
+    const std::string dynamic_label =
+        "DynamicWeightedIndex (" + std::to_string(size) + " entries)";
+    const auto dynamic_checksum = run_case(dynamic_label, "draw", iterations, dynamic_draw);
+
+    // Each update rewrites one weight with a value from the same pattern, so
+    // the table keeps its shape while every ancestor sum is recomputed.
+    std::size_t update_index = 0;
+    auto dynamic_update = [&dynamic, &dynamic_draw, &update_index, size] {
+        update_index = update_index + 7 < size ? update_index + 7 : (update_index + 7) % size;
+        dynamic.set_weight(update_index, static_cast<double>((update_index % 7U) + 1U));
+        return dynamic_draw();
+    };
+    const std::string update_label =
+        "DynamicWeightedIndex update+draw (" + std::to_string(size) + " entries)";
+    const auto update_checksum = run_case(update_label, "op", iterations, dynamic_update);
+
+    std::uint64_t checksum =
+        prepared_checksum ^ mix(alias_checksum + static_cast<std::uint64_t>(size * 3U)) ^
+        mix(eytzinger_checksum + static_cast<std::uint64_t>(size * 4U)) ^
+        mix(guided_checksum + static_cast<std::uint64_t>(size * 5U)) ^
+        mix(dynamic_checksum + static_cast<std::uint64_t>(size * 6U)) ^
+        mix(update_checksum + static_cast<std::uint64_t>(size * 7U)) ^
+        mix(batch_checksum + static_cast<std::uint64_t>(size * 8U));
+
+    // A linear scan over multi-megabyte tables would dominate the run.
+    if (size > linear_reference_limit) {
+        return checksum;
+    }
     const LinearPreparedWeightedIndex linear{weights};
     Storm::Generator linear_generator{seed};
     auto linear_draw = [&linear, &linear_generator] {
@@ -155,7 +329,116 @@ auto weighted_benchmark(const std::size_t size,
         "linear prepared reference (" + std::to_string(size) + " entries)";
     const auto linear_checksum = run_case(linear_label, "draw", iterations, linear_draw);
 
-    return prepared_checksum ^ mix(linear_checksum + static_cast<std::uint64_t>(size));
+    checksum ^= mix(linear_checksum + static_cast<std::uint64_t>(size));
+    return checksum;
+}
+
+// Each call samples one count vector for 10^9 draws; the cost should track the
+// table size and stay flat in the draw count.
+auto counts_benchmark(const std::size_t size,
+                      const std::size_t iterations,
+                      std::uint64_t& warmup_checksum) -> std::uint64_t {
+    constexpr std::uint64_t draws = 1'000'000'000;
+    std::vector<double> weights;
+    weights.reserve(size);
+    for (std::size_t index = 0; index < size; ++index) {
+        weights.push_back(static_cast<double>((index % 7U) + 1U));
+    }
+    const Storm::PreparedWeightedIndex prepared{weights};
+    Storm::Generator generator{seed};
+    auto sample = [&prepared, &generator] {
+        const auto counts = prepared.sample_counts(generator.engine(), draws);
+        return counts.front() ^ counts.back();
+    };
+    const std::size_t calls = std::max<std::size_t>(1, iterations / size);
+    warmup_checksum ^= warm_up(std::max<std::size_t>(1, calls / 10), sample);
+    const std::string label =
+        "sample_counts 10^9 draws (" + std::to_string(size) + " entries)";
+    return run_case(label, "call", calls, sample);
+}
+
+// Each call constructs a generator from a fresh key, as a request handler
+// would, and draws from it.
+template<typename Generator>
+auto keyed_benchmark(const std::string_view name,
+                     const std::size_t draws,
+                     const std::size_t iterations,
+                     std::uint64_t& warmup_checksum) -> std::uint64_t {
+    std::uint64_t key = seed;
+    auto request = [&key, draws] {
+        Generator generator{key++};
+        std::size_t combined = 0;
+        for (std::size_t draw = 0; draw < draws; ++draw) {
+            combined ^= Storm::uniform_index(generator.engine(), bound);
+        }
+        return combined;
+    };
+    const std::size_t calls = std::max<std::size_t>(1, iterations / draws);
+    warmup_checksum ^= warm_up(std::max<std::size_t>(1, calls / 10), request);
+    const std::string label =
+        std::string{name} + " construct + " + std::to_string(draws) + " draws";
+    return run_case(label, "request", calls, request);
+}
+
+// Each call shuffles the whole buffer in place; time is reported per element
+// so the rows compare across sizes.
+template<typename Shuffle>
+auto run_shuffle_case(const std::string_view label,
+                      const std::size_t calls,
+                      std::vector<std::uint32_t>& buffer,
+                      Shuffle& shuffle) -> std::uint64_t {
+    std::uint64_t checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t call = 0; call < calls; ++call) {
+        shuffle(buffer);
+        checksum ^= mix(buffer.front() + (std::uint64_t{buffer.back()} << 32U) + call);
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double, std::nano>{stop - start}.count();
+
+    std::cout << std::left << std::setw(48) << label << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12)
+              << elapsed / static_cast<double>(calls * buffer.size())
+              << " ns/element  checksum=" << checksum << '\n';
+    return checksum;
+}
+
+auto shuffle_benchmark(const std::size_t size,
+                       const std::size_t iterations,
+                       std::uint64_t& warmup_checksum) -> std::uint64_t {
+    std::vector<std::uint32_t> buffer(size);
+    for (std::size_t index = 0; index < size; ++index) {
+        buffer[index] = static_cast<std::uint32_t>(index);
+    }
+    const std::size_t calls = std::max<std::size_t>(1, iterations / size);
+    const std::string suffix = " (" + std::to_string(size) + ")";
+
+    std::mt19937_64 standard_engine{seed};
+    auto standard_shuffle = [&standard_engine](std::vector<std::uint32_t>& values) {
+        std::shuffle(values.begin(), values.end(), standard_engine);
+    };
+    Storm::Generator modulo_generator{seed};
+    auto modulo_shuffle = [&modulo_generator](std::vector<std::uint32_t>& values) {
+        Storm::shuffle(modulo_generator.engine(), values);
+    };
+    Storm::Generator batched_generator{seed};
+    auto batched_shuffle = [&batched_generator](std::vector<std::uint32_t>& values) {
+        Storm::shuffle(batched_generator.engine(), values, Storm::nearly_divisionless_mapping);
+    };
+
+    // One untimed pass each touches the buffer and settles the engines.
+    standard_shuffle(buffer);
+    modulo_shuffle(buffer);
+    batched_shuffle(buffer);
+    warmup_checksum ^= mix(buffer.front() + size);
+
+    const auto standard_checksum =
+        run_shuffle_case("std::shuffle" + suffix, calls, buffer, standard_shuffle);
+    const auto modulo_checksum =
+        run_shuffle_case("Storm::shuffle" + suffix, calls, buffer, modulo_shuffle);
+    const auto batched_checksum =
+        run_shuffle_case("Storm::shuffle batched" + suffix, calls, buffer, batched_shuffle);
+    return standard_checksum ^ mix(modulo_checksum + size) ^ mix(batched_checksum + (size * 2U));
 }
 
 }  // namespace
@@ -189,6 +472,46 @@ auto main(const int argc, char* argv[]) -> int {
         iterations,
         storm_index);
 
+    Storm::BlockGenerator block_index_generator{seed};
+    auto block_index = [&block_index_generator] {
+        return Storm::uniform_index(block_index_generator.engine(), bound);
+    };
+    warmup_checksum ^= warm_up(warmup_iterations, block_index);
+    const auto block_index_checksum = run_case(
+        "Storm::uniform_index (block_mt19937_64)",
+        "draw",
+        iterations,
+        block_index);
+
+    std::mt19937_64 standard_raw_generator{seed};
+    auto standard_raw = [&standard_raw_generator] { return standard_raw_generator(); };
+    warmup_checksum ^= warm_up(warmup_iterations, standard_raw);
+    const auto standard_raw_checksum =
+        run_case("std::mt19937_64 raw", "draw", iterations, standard_raw);
+
+    Storm::block_mt19937_64 block_raw_generator{seed};
+    auto block_raw = [&block_raw_generator] { return block_raw_generator(); };
+    warmup_checksum ^= warm_up(warmup_iterations, block_raw);
+    const auto block_raw_checksum =
+        run_case("Storm::block_mt19937_64 raw", "draw", iterations, block_raw);
+
+    Storm::philox4x64 philox_raw_generator{seed};
+    auto philox_raw = [&philox_raw_generator] { return philox_raw_generator(); };
+    warmup_checksum ^= warm_up(warmup_iterations, philox_raw);
+    const auto philox_raw_checksum =
+        run_case("Storm::philox4x64 raw", "draw", iterations, philox_raw);
+
+    Storm::FastGenerator fast_index_generator{seed};
+    auto fast_index = [&fast_index_generator] {
+        return Storm::uniform_index(fast_index_generator.engine(), bound);
+    };
+    warmup_checksum ^= warm_up(warmup_iterations, fast_index);
+    const auto fast_index_checksum = run_case(
+        "Storm::uniform_index (xoshiro256pp)",
+        "draw",
+        iterations,
+        fast_index);
+
     std::mt19937_64 standard_index_generator{seed};
     std::uniform_int_distribution<std::size_t> standard_index_distribution{0, bound - 1};
     auto standard_index = [&standard_index_generator, &standard_index_distribution] {
@@ -201,6 +524,20 @@ auto main(const int argc, char* argv[]) -> int {
         iterations,
         standard_index);
 
+    std::uint64_t prepared_uniform_checksum = 0;
+    for (const std::size_t size : std::array<std::size_t, 2>{6U, bound}) {
+        const Storm::PreparedUniformIndex prepared_uniform{size};
+        Storm::Generator prepared_uniform_generator{seed};
+        auto prepared_uniform_draw = [&prepared_uniform, &prepared_uniform_generator] {
+            return prepared_uniform(prepared_uniform_generator.engine());
+        };
+        warmup_checksum ^= warm_up(warmup_iterations, prepared_uniform_draw);
+        const std::string label =
+            "PreparedUniformIndex (bound " + std::to_string(size) + ")";
+        prepared_uniform_checksum ^=
+            run_case(label, "draw", iterations, prepared_uniform_draw);
+    }
+
     Storm::Generator storm_canonical_generator{seed};
     auto storm_canonical = [&storm_canonical_generator] {
         return Storm::canonical(storm_canonical_generator.engine());
@@ -212,6 +549,17 @@ auto main(const int argc, char* argv[]) -> int {
         iterations,
         storm_canonical);
 
+    Storm::FastGenerator fast_canonical_generator{seed};
+    auto fast_canonical = [&fast_canonical_generator] {
+        return Storm::canonical(fast_canonical_generator.engine());
+    };
+    warmup_checksum ^= warm_up(warmup_iterations, fast_canonical);
+    const auto fast_canonical_checksum = run_case(
+        "Storm::canonical (xoshiro256pp)",
+        "draw",
+        iterations,
+        fast_canonical);
+
     std::mt19937_64 standard_canonical_generator{seed};
     auto standard_canonical = [&standard_canonical_generator] {
         return std::generate_canonical<double, std::numeric_limits<double>::digits>(
@@ -235,15 +583,56 @@ auto main(const int argc, char* argv[]) -> int {
         iterations,
         storm_ability);
 
+    std::uint64_t fill_checksum = 0;
+    for (const std::size_t size : std::array<std::size_t, 3>{6U, bound, 1'024U}) {
+        fill_checksum ^=
+            fill_benchmark(size, iterations, warmup_iterations, warmup_checksum);
+    }
+
+    std::uint64_t mapping_checksum = 0;
+    for (const std::uint64_t mapped_bound : std::array<std::uint64_t, 4>{
+             6U, 1'024U, 0x8000'0000'0000'0001ULL, 0xFFFF'FFFF'0000'0000ULL}) {
+        mapping_checksum ^=
+            mapping_benchmark(mapped_bound, iterations, warmup_iterations, warmup_checksum);
+    }
+
     std::uint64_t weighted_checksum = 0;
-    for (const std::size_t size : std::array<std::size_t, 3>{4U, 100U, 1'000U}) {
+    for (const std::size_t size : std::array<std::size_t, 7>{
+             4U, 100U, 1'000U, 10'000U, 100'000U, 1'000'000U, 10'000'000U}) {
         weighted_checksum ^=
             weighted_benchmark(size, iterations, warmup_iterations, warmup_checksum);
     }
 
-    const auto combined_checksum = storm_index_checksum ^ standard_index_checksum ^
+    std::uint64_t counts_checksum = 0;
+    for (const std::size_t size : std::array<std::size_t, 3>{4U, 100U, 10'000U}) {
+        counts_checksum ^= counts_benchmark(size, iterations, warmup_checksum);
+    }
+
+    std::uint64_t keyed_checksum = 0;
+    for (const std::size_t draws : std::array<std::size_t, 5>{1U, 10U, 20U, 100U, 1'000U}) {
+        keyed_checksum ^=
+            keyed_benchmark<Storm::Generator>("Generator", draws, iterations, warmup_checksum);
+        keyed_checksum ^= keyed_benchmark<Storm::FastGenerator>(
+            "FastGenerator", draws, iterations, warmup_checksum);
+        keyed_checksum ^= keyed_benchmark<Storm::KeyedGenerator>(
+            "KeyedGenerator", draws, iterations, warmup_checksum);
+    }
+
+    std::uint64_t shuffle_checksum = 0;
+    for (const std::size_t size : std::array<std::size_t, 6>{
+             1'000U, 10'000U, 100'000U, 1'000'000U, 10'000'000U, 100'000'000U}) {
+        shuffle_checksum ^= shuffle_benchmark(size, iterations, warmup_checksum);
+    }
+
+    const auto combined_checksum = storm_index_checksum ^ fast_index_checksum ^
+                                   block_index_checksum ^ standard_raw_checksum ^
+                                   block_raw_checksum ^ philox_raw_checksum ^
+                                   standard_index_checksum ^ fast_canonical_checksum ^
+                                   prepared_uniform_checksum ^
                                    storm_canonical_checksum ^ standard_canonical_checksum ^
-                                   storm_ability_checksum ^ weighted_checksum;
+                                   storm_ability_checksum ^ fill_checksum ^ mapping_checksum ^
+                                   weighted_checksum ^ counts_checksum ^ keyed_checksum ^
+                                   shuffle_checksum;
     std::cout << "\nwarmup checksum=" << warmup_checksum
               << "\ncombined checksum=" << combined_checksum << '\n';
     return 0;
@@ -13,6 +13,7 @@
 #include <limits>
 #include <numeric>
 #include <random>
+#include <string>
 #include <string_view>
 #include <system_error>
 #include <utility>
@@ -113,6 +114,46 @@ auto run_case(const std::string_view label,
     return checksum;
 }
 
+// One scalar uniform_unsigned call per position, the construction loop the
+// selector used before batching its draws.
+auto scalar_knuth_b(Storm::engine_type& engine, const std::size_t size)
+    -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> permutation(size);
+    std::iota(permutation.begin(), permutation.end(), std::uint32_t{0});
+    const std::size_t last = size - 1;
+    std::size_t position = last;
+    while (position > 0) {
+        --position;
+        const auto other = static_cast<std::size_t>(Storm::uniform_unsigned(
+            engine, static_cast<std::uint64_t>(position), static_cast<std::uint64_t>(last)));
+        std::swap(permutation[position], permutation[other]);
+    }
+    return permutation;
+}
+
+auto permutation_checksum(const std::vector<std::uint32_t>& permutation) -> std::uint64_t {
+    std::uint64_t checksum = 0;
+    for (std::size_t index = 0; index < permutation.size(); index += 4'099) {
+        checksum ^= mix(static_cast<std::uint64_t>(permutation[index]) + index);
+    }
+    return checksum;
+}
+
+template<typename Construct>
+auto run_construction(const std::string_view label, const std::size_t size, Construct construct)
+    -> std::uint64_t {
+    const auto start = std::chrono::steady_clock::now();
+    const std::uint64_t checksum = construct();
+    const auto stop = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration<double, std::nano>{stop - start}.count();
+
+    std::cout << std::left << std::setw(42) << label << std::right << std::fixed
+              << std::setprecision(2) << std::setw(12)
+              << elapsed / static_cast<double>(size) << " ns/entry"
+              << "  checksum=" << checksum << '\n';
+    return checksum;
+}
+
 auto parse_iterations(const int argc, char* argv[]) -> std::size_t {
     if (argc == 1) {
         return default_iterations;
@@ -177,6 +218,69 @@ auto main(const int argc, char* argv[]) -> int {
     const std::uint64_t selector_checksum =
         run_case("Storm::wide_index_selector", "draw", iterations, selector_draw);
 
+    // The alias variant draws distances from a different schedule, so its
+    // checksums are reported but not compared.
+    Storm::engine_type alias_engine{seed};
+    Storm::alias_wide_index_selector alias_selector{alias_engine, population_size};
+    auto alias_draw = [&alias_selector, &alias_engine] { return alias_selector(alias_engine); };
+    const std::uint64_t alias_warmup = consume(warmup_iterations, alias_draw);
+    const std::uint64_t alias_checksum =
+        run_case("Storm::alias_wide_index_selector", "draw", iterations, alias_draw);
+
+    constexpr std::size_t wide_population_size = 1'000'000;
+    Storm::engine_type wide_engine{seed};
+    Storm::wide_index_selector wide_selector{wide_engine, wide_population_size};
+    auto wide_draw = [&wide_selector, &wide_engine] { return wide_selector(wide_engine); };
+    Storm::engine_type wide_alias_engine{seed};
+    Storm::alias_wide_index_selector wide_alias_selector{wide_alias_engine,
+                                                         wide_population_size};
+    auto wide_alias_draw = [&wide_alias_selector, &wide_alias_engine] {
+        return wide_alias_selector(wide_alias_engine);
+    };
+    const std::uint64_t wide_warmup =
+        consume(warmup_iterations, wide_draw) ^ consume(warmup_iterations, wide_alias_draw);
+    const std::uint64_t wide_checksum =
+        run_case("wide_index_selector (10^6)", "draw", iterations, wide_draw);
+    const std::uint64_t wide_alias_checksum =
+        run_case("alias_wide_index_selector (10^6)", "draw", iterations, wide_alias_draw);
+
+    // Each request asks for k consecutive picks; both forms must return the
+    // same picks and leave the same engine state.
+    std::uint64_t many_checksum = 0;
+    bool many_equivalent = true;
+    for (const std::size_t picks : {std::size_t{1}, std::size_t{16}, std::size_t{1'024}}) {
+        const std::size_t requests = std::max<std::size_t>(1, iterations / picks);
+        std::vector<std::size_t> output(picks);
+        Storm::engine_type scalar_engine{seed};
+        Storm::wide_index_selector scalar_selector{scalar_engine, population_size};
+        auto scalar_request = [&] {
+            std::uint64_t combined = 0;
+            for (std::size_t& selected : output) {
+                selected = scalar_selector(scalar_engine);
+                combined = mix(combined ^ selected);
+            }
+            return combined;
+        };
+        Storm::engine_type many_engine{seed};
+        Storm::wide_index_selector many_selector{many_engine, population_size};
+        auto many_request = [&] {
+            many_selector.select_many(many_engine, output);
+            std::uint64_t combined = 0;
+            for (const std::size_t selected : output) {
+                combined = mix(combined ^ selected);
+            }
+            return combined;
+        };
+        const std::string suffix = " (k=" + std::to_string(picks) + ")";
+        const std::uint64_t scalar_checksum =
+            run_case("wide_index_selector scalar" + suffix, "request", requests, scalar_request);
+        const std::uint64_t select_many_checksum =
+            run_case("wide_index_selector select_many" + suffix, "request", requests, many_request);
+        many_equivalent = many_equivalent && scalar_checksum == select_many_checksum &&
+                          scalar_engine == many_engine;
+        many_checksum = mix(many_checksum ^ select_many_checksum);
+    }
+
     Storm::engine_type reference_construction_engine{seed};
     Storm::engine_type selector_construction_engine{seed};
     auto construct_reference = [&reference_construction_engine] {
@@ -203,12 +307,43 @@ auto main(const int argc, char* argv[]) -> int {
         construction_iterations,
         construct_selector);
 
+    // Large constructions run once per size; the batched permutation must
+    // match the scalar loop entry for entry and leave the same engine state.
+    std::uint64_t large_checksum = 0;
+    bool large_equivalent = true;
+    constexpr std::array<std::pair<std::string_view, std::size_t>, 3> large_sizes{{
+        {"10^6", 1'000'000},
+        {"10^7", 10'000'000},
+        {"10^8", 100'000'000},
+    }};
+    for (const auto& [label, size] : large_sizes) {
+        Storm::engine_type scalar_engine{seed};
+        Storm::engine_type batched_engine{seed};
+        std::uint64_t scalar_entries = 0;
+        std::uint64_t batched_entries = 0;
+        const std::uint64_t scalar_checksum =
+            run_construction("scalar Knuth-B (" + std::string{label} + ")", size, [&] {
+                scalar_entries = permutation_checksum(scalar_knuth_b(scalar_engine, size));
+                return scalar_entries;
+            });
+        const std::uint64_t batched_checksum =
+            run_construction("batched Knuth-B (" + std::string{label} + ")", size, [&] {
+                batched_entries = permutation_checksum(
+                    Storm::detail::make_wide_permutation<std::uint32_t>(batched_engine, size));
+                return batched_entries;
+            });
+        large_equivalent = large_equivalent && scalar_entries == batched_entries &&
+                           scalar_engine == batched_engine;
+        large_checksum = mix(large_checksum ^ scalar_checksum ^ batched_checksum);
+    }
+
     const bool equivalent = reference_warmup == selector_warmup &&
                             reference_checksum == selector_checksum &&
                             reference_construction_warmup == selector_construction_warmup &&
                             reference_construction_checksum == selector_construction_checksum &&
                             reference_engine == selector_engine &&
-                            reference_construction_engine == selector_construction_engine;
+                            reference_construction_engine == selector_construction_engine &&
+                            large_equivalent && many_equivalent;
     const std::array checksums{
         reference_warmup,
         selector_warmup,
@@ -218,6 +353,13 @@ auto main(const int argc, char* argv[]) -> int {
         selector_construction_warmup,
         reference_construction_checksum,
         selector_construction_checksum,
+        alias_warmup,
+        alias_checksum,
+        wide_warmup,
+        wide_checksum,
+        wide_alias_checksum,
+        many_checksum,
+        large_checksum,
     };
     std::uint64_t combined_checksum = 0;
     for (const std::uint64_t checksum : checksums) {
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <bit>
 #include <cmath>
 #include <concepts>
@@ -11,19 +12,77 @@
 #include <initializer_list>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
 #include <numeric>
 #include <random>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
 namespace Storm {
 
 using engine_type = std::mt19937_64;
 
 inline constexpr char version[] = "5.1.0";
 
+// Bounded-mapping policies. Modulo mapping is the documented default schedule;
+// nearly-divisionless mapping is an opt-in, differently mapped schedule.
+struct modulo_mapping_t {
+    explicit modulo_mapping_t() = default;
+};
+struct nearly_divisionless_mapping_t {
+    explicit nearly_divisionless_mapping_t() = default;
+};
+inline constexpr modulo_mapping_t modulo_mapping{};
+inline constexpr nearly_divisionless_mapping_t nearly_divisionless_mapping{};
+
+// Search layouts for prepared cumulative tables. Every layout returns the same
+// strict-boundary index for the same draw.
+enum class cumulative_layout {
+    sorted,
+    eytzinger,
+};
+
+// Output orders for sample_indices. Sorted output is ascending; random output
+// is a uniformly random ordering of the same kind of sample.
+enum class sample_order {
+    sorted,
+    random,
+};
+
+// Requests a guide table of cutpoints over a sorted cumulative table. More
+// cutpoints use more memory and narrow each search further.
+struct guide_table {
+    std::size_t cutpoints;
+};
+
+template<typename Mapping>
+concept bounded_mapping = std::same_as<Mapping, modulo_mapping_t> ||
+                          std::same_as<Mapping, nearly_divisionless_mapping_t>;
+
+// Engines accepted by Storm's algorithms: uniform random bit generators whose
+// results cover every 64-bit value, as engine_type's do.
+template<typename Engine>
+concept random_engine =
+    std::uniform_random_bit_generator<Engine> &&
+    std::numeric_limits<std::invoke_result_t<Engine&>>::digits == 64 &&
+    (Engine::min() == 0) && (Engine::max() == std::numeric_limits<std::uint64_t>::max());
+
 namespace detail {
 
 inline constexpr std::uint64_t sign_bit = std::uint64_t{1} << 63U;
@@ -39,11 +98,14 @@ inline constexpr auto signed_from_key(const std::uint64_t key) noexcept -> std::
     return std::bit_cast<std::int64_t>(key ^ sign_bit);
 }
 
-inline auto bounded(engine_type& engine, const std::uint64_t bound) noexcept -> std::uint64_t {
-    if (bound == 0) {
-        return static_cast<std::uint64_t>(engine());
-    }
-    const std::uint64_t threshold = (std::uint64_t{0} - bound) % bound;
+inline constexpr auto bounded_threshold(const std::uint64_t bound) noexcept -> std::uint64_t {
+    return (std::uint64_t{0} - bound) % bound;
+}
+
+template<random_engine Engine>
+inline auto bounded_above(Engine& engine,
+                          const std::uint64_t bound,
+                          const std::uint64_t threshold) noexcept -> std::uint64_t {
     for (;;) {
         const auto value = static_cast<std::uint64_t>(engine());
         if (value >= threshold) {
@@ -52,7 +114,262 @@ inline auto bounded(engine_type& engine, const std::uint64_t bound) noexcept ->
     }
 }
 
-inline void seed_from_entropy(engine_type& engine) {
+template<random_engine Engine>
+inline auto bounded(Engine& engine, const std::uint64_t bound) noexcept -> std::uint64_t {
+    if (bound == 0) {
+        return static_cast<std::uint64_t>(engine());
+    }
+    return bounded_above(engine, bound, bounded_threshold(bound));
+}
+
+template<random_engine Engine>
+inline auto bounded(Engine& engine,
+                    const std::uint64_t bound,
+                    modulo_mapping_t /*mapping*/) noexcept -> std::uint64_t {
+    return bounded(engine, bound);
+}
+
+// Equivalent to bounded(engine, bound) for a nonzero bound, in values and
+// engine advancement. The threshold is below bound, so a value at or above
+// bound is accepted without dividing to compute it.
+template<random_engine Engine>
+inline auto bounded_deferred(Engine& engine, const std::uint64_t bound) noexcept
+    -> std::uint64_t {
+    const auto value = static_cast<std::uint64_t>(engine());
+    if (value >= bound) {
+        return value % bound;
+    }
+    const std::uint64_t threshold = bounded_threshold(bound);
+    if (value >= threshold) {
+        return value;
+    }
+    return bounded_above(engine, bound, threshold);
+}
+
+inline constexpr auto multiply_wide_portable(const std::uint64_t left,
+                                             const std::uint64_t right,
+                                             std::uint64_t& low) noexcept -> std::uint64_t {
+    constexpr std::uint64_t half_mask = 0xFFFF'FFFFULL;
+    const std::uint64_t left_low = left & half_mask;
+    const std::uint64_t left_high = left >> 32U;
+    const std::uint64_t right_low = right & half_mask;
+    const std::uint64_t right_high = right >> 32U;
+    const std::uint64_t low_low = left_low * right_low;
+    const std::uint64_t high_low = left_high * right_low;
+    const std::uint64_t low_high = left_low * right_high;
+    const std::uint64_t high_high = left_high * right_high;
+    const std::uint64_t middle = (low_low >> 32U) + (high_low & half_mask) + low_high;
+    low = (middle << 32U) | (low_low & half_mask);
+    return high_high + (high_low >> 32U) + (middle >> 32U);
+}
+
+// Returns the high word of the 128-bit product and stores its low word.
+inline constexpr auto multiply_wide(const std::uint64_t left,
+                                    const std::uint64_t right,
+                                    std::uint64_t& low) noexcept -> std::uint64_t {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128 = unsigned __int128;
+    const uint128 product = static_cast<uint128>(left) * right;
+    low = static_cast<std::uint64_t>(product);
+    return static_cast<std::uint64_t>(product >> 64U);
+#else
+    return multiply_wide_portable(left, right, low);
+#endif
+}
+
+// Lemire's nearly-divisionless multiply-high mapping. The threshold division
+// runs only when the low product word falls below the bound.
+template<random_engine Engine>
+inline auto bounded_multiply_above(Engine& engine,
+                                   const std::uint64_t bound,
+                                   const std::uint64_t threshold) noexcept
+    -> std::uint64_t {
+    std::uint64_t low = 0;
+    std::uint64_t high = multiply_wide(static_cast<std::uint64_t>(engine()), bound, low);
+    while (low < threshold) {
+        high = multiply_wide(static_cast<std::uint64_t>(engine()), bound, low);
+    }
+    return high;
+}
+
+template<random_engine Engine>
+inline auto bounded(Engine& engine,
+                    const std::uint64_t bound,
+                    nearly_divisionless_mapping_t /*mapping*/) noexcept -> std::uint64_t {
+    if (bound == 0) {
+        return static_cast<std::uint64_t>(engine());
+    }
+    std::uint64_t low = 0;
+    const std::uint64_t high =
+        multiply_wide(static_cast<std::uint64_t>(engine()), bound, low);
+    if (low >= bound) {
+        return high;
+    }
+    const std::uint64_t threshold = bounded_threshold(bound);
+    if (low >= threshold) {
+        return high;
+    }
+    return bounded_multiply_above(engine, bound, threshold);
+}
+
+// Brackett-Rozinsky and Lemire's batched multiply-high mapping. One engine
+// value yields indices[j] below first - j for each j < indices.size(); the
+// low word left after each product feeds the next. The tuple is rejected as a
+// whole when the final low word falls below 2^64 mod product, where product,
+// the bounds' product, must not exceed 2^64.
+template<random_engine Engine>
+inline void bounded_descending_batch(Engine& engine,
+                                     const std::uint64_t first,
+                                     const std::uint64_t product,
+                                     const std::span<std::uint64_t> indices) noexcept {
+    const auto extract = [&engine, first, indices] {
+        auto low = static_cast<std::uint64_t>(engine());
+        for (std::size_t offset = 0; offset < indices.size(); ++offset) {
+            indices[offset] = multiply_wide(low, first - offset, low);
+        }
+        return low;
+    };
+    std::uint64_t low = extract();
+    if (low < product) {
+        const std::uint64_t threshold = bounded_threshold(product);
+        while (low < threshold) {
+            low = extract();
+        }
+    }
+}
+
+// Fills output with exactly the draws repeated bounded() calls would make. A
+// power-of-two bound has a zero threshold, so its reduction becomes a mask.
+template<typename Value, typename Transform, random_engine Engine>
+void bounded_fill(Engine& engine,
+                  const std::uint64_t bound,
+                  const std::span<Value> output,
+                  const Transform transform,
+                  modulo_mapping_t /*mapping*/ = modulo_mapping) {
+    if (bound == 0) {
+        for (Value& value : output) {
+            value = transform(static_cast<std::uint64_t>(engine()));
+        }
+        return;
+    }
+    if (std::has_single_bit(bound)) {
+        const std::uint64_t mask = bound - 1;
+        for (Value& value : output) {
+            value = transform(static_cast<std::uint64_t>(engine()) & mask);
+        }
+        return;
+    }
+    const std::uint64_t threshold = bounded_threshold(bound);
+    for (Value& value : output) {
+        value = transform(bounded_above(engine, bound, threshold));
+    }
+}
+
+// A fill divides at most once for the whole span instead of on each rare
+// low-word rejection.
+template<typename Value, typename Transform, random_engine Engine>
+void bounded_fill(Engine& engine,
+                  const std::uint64_t bound,
+                  const std::span<Value> output,
+                  const Transform transform,
+                  nearly_divisionless_mapping_t /*mapping*/) {
+    if (bound == 0) {
+        for (Value& value : output) {
+            value = transform(static_cast<std::uint64_t>(engine()));
+        }
+        return;
+    }
+    if (output.empty()) {
+        return;
+    }
+    const std::uint64_t threshold = bounded_threshold(bound);
+    for (Value& value : output) {
+        value = transform(bounded_multiply_above(engine, bound, threshold));
+    }
+}
+
+// Division-free remainder by a fixed 64-bit divisor (Lemire, Kaser, and Kurz).
+// The 128-bit multiplier is ceil(2^128 / divisor), kept modulo 2^128.
+class fixed_remainder {
+public:
+    constexpr explicit fixed_remainder(const std::uint64_t divisor) noexcept
+        : divisor_{divisor} {
+        constexpr std::uint64_t all_ones = std::numeric_limits<std::uint64_t>::max();
+        multiplier_high_ = all_ones / divisor;
+        std::uint64_t remainder = all_ones % divisor;
+        for (unsigned bit = 0; bit < 64U; ++bit) {
+            const bool carry = (remainder >> 63U) != 0U;
+            remainder = (remainder << 1U) | 1U;
+            multiplier_low_ <<= 1U;
+            if (carry || remainder >= divisor) {
+                remainder -= divisor;
+                multiplier_low_ |= 1U;
+            }
+        }
+        ++multiplier_low_;
+        if (multiplier_low_ == 0) {
+            ++multiplier_high_;
+        }
+    }
+
+    [[nodiscard]] constexpr auto operator()(const std::uint64_t value) const noexcept
+        -> std::uint64_t {
+        std::uint64_t fraction_low = 0;
+        const std::uint64_t fraction_high =
+            multiply_wide(multiplier_low_, value, fraction_low) + multiplier_high_ * value;
+        std::uint64_t ignored = 0;
+        const std::uint64_t carry_in = multiply_wide(fraction_low, divisor_, ignored);
+        std::uint64_t top_low = 0;
+        const std::uint64_t top_high = multiply_wide(fraction_high, divisor_, top_low);
+        return top_high + (top_low + carry_in < top_low ? 1U : 0U);
+    }
+
+private:
+    std::uint64_t divisor_;
+    std::uint64_t multiplier_high_{0};
+    std::uint64_t multiplier_low_{0};
+};
+
+struct range_schedule {
+    std::uint64_t start_key;
+    std::uint64_t stride;
+    std::uint64_t count;
+    bool ascending;
+
+    [[nodiscard]] constexpr auto value(const std::uint64_t offset) const noexcept
+        -> std::int64_t {
+        return ascending ? signed_from_key(start_key + offset * stride)
+                         : signed_from_key(start_key - offset * stride);
+    }
+};
+
+inline auto make_range_schedule(const std::int64_t start,
+                                const std::int64_t stop,
+                                const std::int64_t step) -> range_schedule {
+    if (step == 0) {
+        throw std::invalid_argument{"random_range step must not be zero"};
+    }
+    const std::uint64_t start_key = signed_key(start);
+    if (step > 0) {
+        if (start >= stop) {
+            throw std::invalid_argument{"random_range is empty for this positive step"};
+        }
+        const auto stride = static_cast<std::uint64_t>(step);
+        const std::uint64_t span = signed_key(stop) - start_key;
+        const std::uint64_t count = ((span - std::uint64_t{1}) / stride) + std::uint64_t{1};
+        return {start_key, stride, count, true};
+    }
+    if (start <= stop) {
+        throw std::invalid_argument{"random_range is empty for this negative step"};
+    }
+    const std::uint64_t stride = std::uint64_t{0} - static_cast<std::uint64_t>(step);
+    const std::uint64_t span = start_key - signed_key(stop);
+    const std::uint64_t count = ((span - std::uint64_t{1}) / stride) + std::uint64_t{1};
+    return {start_key, stride, count, false};
+}
+
+template<random_engine Engine>
+inline void seed_from_entropy(Engine& engine) {
     std::random_device source;
     std::array<std::uint32_t, 16> words{};
     for (auto& word : words) {
@@ -62,15 +379,319 @@ inline void seed_from_entropy(engine_type& engine) {
     engine.seed(sequence);
 }
 
-inline auto select_prepared_weighted_index(engine_type& engine,
+inline void prefetch(const void* const address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+[[nodiscard]] constexpr auto low_word(const std::uint64_t value) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(value);
+}
+
+[[nodiscard]] constexpr auto high_word(const std::uint64_t value) noexcept -> std::uint32_t {
+    return static_cast<std::uint32_t>(value >> 32U);
+}
+
+inline constexpr std::size_t cache_line_size = 64;
+
+template<typename Value>
+struct cache_aligned_allocator {
+    using value_type = Value;
+
+    cache_aligned_allocator() noexcept = default;
+    template<typename Other>
+    explicit cache_aligned_allocator(const cache_aligned_allocator<Other>& /*other*/) noexcept {}
+
+    [[nodiscard]] auto allocate(const std::size_t count) -> Value* {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(Value)) {
+            throw std::bad_array_new_length{};
+        }
+        return static_cast<Value*>(::operator new(
+            count * sizeof(Value), std::align_val_t{cache_line_size}));
+    }
+
+    void deallocate(Value* const pointer, const std::size_t /*count*/) noexcept {
+        ::operator delete(pointer, std::align_val_t{cache_line_size});
+    }
+
+    template<typename Other>
+    auto operator==(const cache_aligned_allocator<Other>& /*other*/) const noexcept -> bool {
+        return true;
+    }
+};
+
+// Sorted boundaries stored in breadth-first (Eytzinger) order from index one.
+// Cache-line alignment places the eight descendants of a node three levels
+// down in one line, so a search prefetches that line as it descends.
+class eytzinger_index {
+public:
+    eytzinger_index() = default;
+
+    explicit eytzinger_index(const std::vector<double>& sorted)
+        : nodes_(sorted.size() + 1), depth_{static_cast<unsigned>(std::bit_width(sorted.size()))} {
+        std::size_t next = 0;
+        build(sorted, next, 1);
+        const std::size_t full_levels = (std::size_t{1} << (depth_ - 1U)) - 1U;
+        last_level_ = sorted.size() - full_levels;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return nodes_.empty(); }
+
+    // Equivalent to std::ranges::upper_bound over the sorted boundaries.
+    [[nodiscard]] auto upper_bound(const double value) const noexcept -> std::size_t {
+        constexpr unsigned prefetch_levels = 3;
+        const std::size_t count = nodes_.size() - 1;
+        const auto base = reinterpret_cast<std::uintptr_t>(nodes_.data());
+        std::size_t node = 1;
+        while (node <= count) {
+            prefetch(reinterpret_cast<const void*>(
+                base + (node << prefetch_levels) * sizeof(double)));
+            node = 2 * node + (nodes_[node] <= value ? 1U : 0U);
+        }
+        node >>= static_cast<unsigned>(std::countr_one(node)) + 1U;
+        return node == 0 ? count : rank(node);
+    }
+
+private:
+    // In-order rank of a node: its rank in the perfect tree of the same depth,
+    // less the absent last-level nodes that would precede it.
+    [[nodiscard]] auto rank(const std::size_t node) const noexcept -> std::size_t {
+        const auto level = static_cast<unsigned>(std::bit_width(node)) - 1U;
+        const std::size_t position = node - (std::size_t{1} << level);
+        const std::size_t perfect = ((2 * position + 1) << (depth_ - 1U - level)) - 1U;
+        const std::size_t preceding_slots = (perfect + 1) / 2;
+        return preceding_slots > last_level_ ? perfect - (preceding_slots - last_level_)
+                                             : perfect;
+    }
+
+    void build(const std::vector<double>& sorted, std::size_t& next, const std::size_t node) {
+        if (node >= nodes_.size()) {
+            return;
+        }
+        build(sorted, next, 2 * node);
+        nodes_[node] = sorted[next];
+        ++next;
+        build(sorted, next, 2 * node + 1);
+    }
+
+    std::vector<double, cache_aligned_allocator<double>> nodes_;
+    unsigned depth_{0};
+    std::size_t last_level_{0};
+};
+
+// Chen and Asau's guide table. Bucket j starts at the first boundary whose own
+// bucket is at least j; because bucketing is monotone, a draw in bucket j has
+// its upper bound between the starts of buckets j and j + 1.
+class guide_index {
+public:
+    guide_index() = default;
+
+    guide_index(const std::vector<double>& sorted,
+                const double total,
+                const std::size_t cutpoints)
+        : scale_{static_cast<double>(cutpoints) / total} {
+        if (!std::isfinite(scale_)) {
+            return;
+        }
+        starts_.resize(cutpoints + 1);
+        std::size_t index = 0;
+        for (std::size_t bucket_index = 0; bucket_index < cutpoints; ++bucket_index) {
+            while (index < sorted.size() && bucket(sorted[index]) < bucket_index) {
+                ++index;
+            }
+            starts_[bucket_index] = index;
+        }
+        starts_[cutpoints] = sorted.size();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool { return starts_.empty(); }
+
+    // Equivalent to std::ranges::upper_bound over the same sorted boundaries.
+    [[nodiscard]] auto upper_bound(const std::vector<double>& sorted,
+                                   const double value) const noexcept -> std::size_t {
+        const std::size_t bucket_index = bucket(value);
+        const auto first = sorted.begin() + static_cast<std::ptrdiff_t>(starts_[bucket_index]);
+        const auto last =
+            sorted.begin() + static_cast<std::ptrdiff_t>(starts_[bucket_index + 1]);
+        return static_cast<std::size_t>(std::upper_bound(first, last, value) - sorted.begin());
+    }
+
+private:
+    [[nodiscard]] auto bucket(const double value) const noexcept -> std::size_t {
+        const double scaled = value * scale_;
+        const std::size_t last = starts_.size() - 2;
+        return scaled < static_cast<double>(last) ? static_cast<std::size_t>(scaled) : last;
+    }
+
+    double scale_{0.0};
+    std::vector<std::size_t> starts_;
+};
+
+struct prepared_search {
+    eytzinger_index eytzinger;
+    guide_index guide;
+};
+
+inline auto search_prepared_weighted_index(const std::vector<double>& cumulative,
+                                           const prepared_search& search,
+                                           const double effective_draw) noexcept
+    -> std::size_t {
+    if (!search.eytzinger.empty()) {
+        return search.eytzinger.upper_bound(effective_draw);
+    }
+    if (!search.guide.empty()) {
+        return search.guide.upper_bound(cumulative, effective_draw);
+    }
+    const auto selected = std::ranges::upper_bound(cumulative, effective_draw);
+    return static_cast<std::size_t>(selected - cumulative.begin());
+}
+
+template<random_engine Engine>
+inline auto select_prepared_weighted_index(Engine& engine,
                                            const std::vector<double>& cumulative,
+                                           const prepared_search& search,
                                            const double total,
                                            const double maximum_draw) -> std::size_t {
     std::uniform_real_distribution<double> distribution{0.0, total};
     const double draw = distribution(engine);
     const double effective_draw = draw < total ? draw : maximum_draw;
-    const auto selected = std::ranges::upper_bound(cumulative, effective_draw);
-    return static_cast<std::size_t>(selected - cumulative.begin());
+    return search_prepared_weighted_index(cumulative, search, effective_draw);
+}
+
+inline constexpr std::size_t selection_batch = 32;
+
+// Branch-free upper_bound for a batch of values over the same sorted table.
+// Every lane takes the same number of halving steps, so the lanes advance in
+// lockstep and each step prefetches every lane's next probe before any of
+// them is read, keeping several cache misses in flight at once.
+inline void upper_bound_interleaved(const std::vector<double>& sorted,
+                                    const std::span<const double> values,
+                                    const std::span<std::size_t> output) noexcept {
+    std::array<std::size_t, selection_batch> bases{};
+    const double* const data = sorted.data();
+    std::size_t length = sorted.size();
+    while (length > 1) {
+        const std::size_t half = length / 2;
+        const std::size_t next_half = (length - half) / 2;
+        for (std::size_t lane = 0; lane < values.size(); ++lane) {
+            const std::size_t probe = bases[lane] + half;
+            bases[lane] = data[probe] <= values[lane] ? probe : bases[lane];
+            prefetch(data + bases[lane] + next_half);
+        }
+        length -= half;
+    }
+    for (std::size_t lane = 0; lane < values.size(); ++lane) {
+        output[lane] = bases[lane] + (data[bases[lane]] <= values[lane] ? 1U : 0U);
+    }
+}
+
+// Draws a whole batch first with the scalar schedule, then searches it. The
+// searches consume no engine state, so the output and engine advancement
+// equal repeated select_prepared_weighted_index calls.
+template<random_engine Engine>
+inline void select_prepared_weighted_indices(Engine& engine,
+                                             const std::vector<double>& cumulative,
+                                             const prepared_search& search,
+                                             const double total,
+                                             const double maximum_draw,
+                                             const std::span<std::size_t> output) {
+    std::uniform_real_distribution<double> distribution{0.0, total};
+    std::array<double, selection_batch> draws{};
+    const bool plain = search.eytzinger.empty() && search.guide.empty();
+    for (std::size_t offset = 0; offset < output.size(); offset += selection_batch) {
+        const std::span<std::size_t> block =
+            output.subspan(offset, std::min(selection_batch, output.size() - offset));
+        for (std::size_t lane = 0; lane < block.size(); ++lane) {
+            const double draw = distribution(engine);
+            draws[lane] = draw < total ? draw : maximum_draw;
+        }
+        const std::span<const double> values{draws.data(), block.size()};
+        if (plain) {
+            upper_bound_interleaved(cumulative, values, block);
+            continue;
+        }
+        for (std::size_t lane = 0; lane < block.size(); ++lane) {
+            block[lane] = search_prepared_weighted_index(cumulative, search, values[lane]);
+        }
+    }
+}
+
+inline void validate_guide_table(const guide_table guide, const std::string_view owner) {
+    if (guide.cutpoints == 0) {
+        throw std::invalid_argument{std::string{owner} +
+                                    " requires a guide table with at least one cutpoint"};
+    }
+    if (guide.cutpoints >= std::vector<std::size_t>{}.max_size()) {
+        throw std::length_error{std::string{owner} + " guide table is too large"};
+    }
+}
+
+// Shared relative-weight validation for the prepared weighted selectors.
+inline auto add_validated_weight(const double total,
+                                 const double weight,
+                                 const std::string_view owner) -> double {
+    if (!std::isfinite(weight) || weight < 0.0) {
+        throw std::invalid_argument{std::string{owner} +
+                                    " requires finite, nonnegative weights"};
+    }
+    if (weight > std::numeric_limits<double>::max() - total) {
+        throw std::overflow_error{std::string{owner} +
+                                  " total weight is not representable"};
+    }
+    return total + weight;
+}
+
+inline void validate_weight_total(const std::size_t count,
+                                  const double total,
+                                  const std::string_view owner) {
+    if (count == 0) {
+        throw std::invalid_argument{std::string{owner} + " requires at least one weight"};
+    }
+    if (total == 0.0) {
+        throw std::invalid_argument{std::string{owner} +
+                                    " requires at least one positive weight"};
+    }
+}
+
+struct alias_entry {
+    std::uint64_t threshold;
+    std::size_t alias;
+};
+
+// Vose's linear-time alias construction. Each column keeps itself when a
+// 64-bit draw is below its threshold and otherwise yields its alias.
+inline auto make_alias_table(const std::vector<double>& weights, const double total)
+    -> std::vector<alias_entry> {
+    const std::size_t count = weights.size();
+    constexpr double two_to_64 = 0x1.0p64;
+    std::vector<alias_entry> table(count);
+    std::vector<double> scaled(count);
+    std::vector<std::size_t> small;
+    std::vector<std::size_t> large;
+    small.reserve(count);
+    large.reserve(count);
+    for (std::size_t index = 0; index < count; ++index) {
+        scaled[index] = weights[index] / total * static_cast<double>(count);
+        table[index] = {std::numeric_limits<std::uint64_t>::max(), index};
+        (scaled[index] < 1.0 ? small : large).push_back(index);
+    }
+    while (!small.empty() && !large.empty()) {
+        const std::size_t lesser = small.back();
+        small.pop_back();
+        const std::size_t greater = large.back();
+        const double threshold = scaled[lesser] * two_to_64;
+        table[lesser] = {static_cast<std::uint64_t>(threshold), greater};
+        scaled[greater] = (scaled[greater] + scaled[lesser]) - 1.0;
+        if (scaled[greater] < 1.0) {
+            large.pop_back();
+            small.push_back(greater);
+        }
+    }
+    // Columns left in either list are full up to rounding and keep themselves.
+    return table;
 }
 
 inline void insert_ability_roll(std::array<std::uint64_t, 3>& best,
@@ -111,122 +732,1276 @@ inline constexpr auto integer_sqrt(const std::size_t value) noexcept -> std::siz
     return result;
 }
 
-inline constexpr auto subtract_modulo(const std::size_t value,
-                                      const std::size_t decrement,
-                                      const std::size_t modulus) noexcept -> std::size_t {
-    const std::size_t reduced_decrement = decrement % modulus;
-    if (value >= reduced_decrement) {
-        return value - reduced_decrement;
-    }
-    return modulus - (reduced_decrement - value);
+// Steele, Lea, and Flood's SplitMix64 step, the seeding generator Vigna
+// recommends for the xoshiro family.
+inline constexpr auto splitmix64_finalize(std::uint64_t mixed) noexcept -> std::uint64_t {
+    mixed = (mixed ^ (mixed >> 30U)) * 0xBF58'476D'1CE4'E5B9ULL;
+    mixed = (mixed ^ (mixed >> 27U)) * 0x94D0'49BB'1331'11EBULL;
+    return mixed ^ (mixed >> 31U);
 }
 
-}  // namespace detail
-
-class Generator {
-public:
-    explicit Generator(const std::uint64_t seed_value = 0) : engine_{seed_value} {}
-
-    [[nodiscard]] auto engine() noexcept -> engine_type& { return engine_; }
-    [[nodiscard]] auto engine() const noexcept -> const engine_type& { return engine_; }
-    void seed(const std::uint64_t seed_value) { engine_.seed(seed_value); }
-    void reseed_from_entropy() { detail::seed_from_entropy(engine_); }
-
-private:
-    engine_type engine_;
-};
-
-[[nodiscard]] inline auto thread_engine() -> engine_type& {
-    // Deterministic initialization, including seed zero, is part of Storm's public contract.
-    thread_local engine_type engine{0};  // NOLINT(cert-msc51-cpp)
-    return engine;
+inline constexpr auto splitmix64(std::uint64_t& state) noexcept -> std::uint64_t {
+    state += 0x9E37'79B9'7F4A'7C15ULL;
+    return splitmix64_finalize(state);
 }
 
-inline void seed(const std::uint64_t seed_value) { thread_engine().seed(seed_value); }
-inline void reseed_from_entropy() { detail::seed_from_entropy(thread_engine()); }
-
-inline auto canonical(engine_type& engine) noexcept -> double {
+template<random_engine Engine>
+inline auto canonical_draw(Engine& engine) noexcept -> double {
     constexpr double scale = 0x1.0p-53;
     return static_cast<double>(engine() >> 11U) * scale;
 }
 
-inline auto canonical() -> double { return canonical(thread_engine()); }
-
-class PreparedWeightedIndex {
-public:
-    explicit PreparedWeightedIndex(const std::initializer_list<double> weights) {
-        cumulative_.reserve(weights.size());
-        initialize(weights.begin(), weights.end());
+// BTRD's Stirling remainder fc(k) = log(k!) - log(sqrt(2 pi)) -
+// (k + 1/2) log(k + 1) + (k + 1), tabulated below ten.
+inline auto stirling_correction(const double k) noexcept -> double {
+    constexpr std::array<double, 10> table{
+        0.08106146679532726, 0.04134069595540929, 0.02767792568499834,
+        0.02079067210376509, 0.01664469118982119, 0.01387612882307075,
+        0.01189670994589177, 0.01041126526197209, 0.009255462182712733,
+        0.008330563433362871,
+    };
+    if (k < static_cast<double>(table.size())) {
+        return table[static_cast<std::size_t>(k)];
     }
+    const double reciprocal = 1.0 / (k + 1.0);
+    const double squared = reciprocal * reciprocal;
+    return (1.0 / 12.0 - (1.0 / 360.0 - squared / 1260.0) * squared) * reciprocal;
+}
 
-    template<std::ranges::input_range Range>
-        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
-    explicit PreparedWeightedIndex(Range&& weights) {
-        if constexpr (std::ranges::sized_range<Range>) {
-            cumulative_.reserve(static_cast<std::size_t>(std::ranges::size(weights)));
+// Inversion by sequential search from zero; expected work is O(n p), so it is
+// used only for means below binomial_inversion_limit.
+template<random_engine Engine>
+inline auto binomial_inversion(Engine& engine,
+                               const std::uint64_t trials,
+                               const double probability) noexcept -> std::uint64_t {
+    const double odds = probability / (1.0 - probability);
+    const double scaled_odds = (static_cast<double>(trials) + 1.0) * odds;
+    const double first = std::exp(static_cast<double>(trials) * std::log1p(-probability));
+    while (true) {
+        double remaining = canonical_draw(engine);
+        double mass = first;
+        std::uint64_t successes = 0;
+        while (remaining >= mass && successes < trials) {
+            remaining -= mass;
+            ++successes;
+            mass *= scaled_odds / static_cast<double>(successes) - odds;
+            if (mass <= 0.0) {
+                break;
+            }
+        }
+        // The tail beyond the last representable mass is negligible; redraw
+        // rather than return a biased value when rounding exhausts it.
+        if (remaining < mass || successes == trials) {
+            return successes;
         }
-        initialize(std::ranges::begin(weights), std::ranges::end(weights));
     }
+}
 
-    [[nodiscard]] auto operator()(engine_type& engine) const -> std::size_t {
-        return detail::select_prepared_weighted_index(
-            engine, cumulative_, total_, maximum_draw_);
-    }
+// Hormann's BTRD transformed rejection with decomposition, "The generation of
+// binomial random variates" (1993). Expected O(1) work for n p >= 10 and
+// p <= 1/2.
+template<random_engine Engine>
+inline auto binomial_btrd(Engine& engine,
+                          const std::uint64_t trials,
+                          const double probability) noexcept -> std::uint64_t {
+    const auto n = static_cast<double>(trials);
+    const double complement = 1.0 - probability;
+    const double mode = std::floor((n + 1.0) * probability);
+    const double odds = probability / complement;
+    const double scaled_odds = (n + 1.0) * odds;
+    const double variance = n * probability * complement;
+    const double deviation = std::sqrt(variance);
+    const double b = 1.15 + 2.53 * deviation;
+    const double a = -0.0873 + 0.0248 * b + 0.01 * probability;
+    const double c = n * probability + 0.5;
+    const double alpha = (2.83 + 5.1 / b) * deviation;
+    const double v_r = 0.92 - 4.2 / b;
+    const double u_r_v_r = 0.86 * v_r;
+    const double mode_correction =
+        (mode + 0.5) * std::log((mode + 1.0) / (odds * (n - mode + 1.0))) +
+        stirling_correction(mode) + stirling_correction(n - mode);
 
-private:
-    template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
-        requires std::convertible_to<std::iter_reference_t<Iterator>, double>
-    void initialize(Iterator first, const Sentinel last) {
-        for (; first != last; ++first) {
-            const auto weight = static_cast<double>(*first);
-            if (!std::isfinite(weight) || weight < 0.0) {
-                throw std::invalid_argument{
-                    "PreparedWeightedIndex requires finite, nonnegative weights"};
+    while (true) {
+        double v = canonical_draw(engine);
+        double u = 0.0;
+        if (v <= u_r_v_r) {
+            u = v / v_r - 0.43;
+            const double k = std::floor((2.0 * a / (0.5 - std::fabs(u)) + b) * u + c);
+            if (k >= 0.0 && k <= n) {
+                return static_cast<std::uint64_t>(k);
             }
-            if (weight > std::numeric_limits<double>::max() - total_) {
-                throw std::overflow_error{
-                    "PreparedWeightedIndex total weight is not representable"};
+            continue;
+        }
+        if (v >= v_r) {
+            u = canonical_draw(engine) - 0.5;
+        } else {
+            u = v / v_r - 0.93;
+            u = std::copysign(0.5, u) - u;
+            v = canonical_draw(engine) * v_r;
+        }
+
+        const double shifted = 0.5 - std::fabs(u);
+        const double k = std::floor((2.0 * a / shifted + b) * u + c);
+        if (k < 0.0 || k > n) {
+            continue;
+        }
+        v = v * alpha / (a / (shifted * shifted) + b);
+        const double distance = std::fabs(k - mode);
+        if (distance <= 15.0) {
+            double ratio = 1.0;
+            if (mode < k) {
+                for (double i = mode + 1.0; i <= k; i += 1.0) {
+                    ratio *= scaled_odds / i - odds;
+                }
+            } else {
+                for (double i = k + 1.0; i <= mode; i += 1.0) {
+                    v *= scaled_odds / i - odds;
+                }
             }
-            total_ += weight;
-            cumulative_.push_back(total_);
+            if (v <= ratio) {
+                return static_cast<std::uint64_t>(k);
+            }
+            continue;
         }
-        if (cumulative_.empty()) {
-            throw std::invalid_argument{"PreparedWeightedIndex requires at least one weight"};
+
+        v = std::log(v);
+        const double rho = (distance / variance) *
+                           (((distance / 3.0 + 0.625) * distance + 1.0 / 6.0) / variance + 0.5);
+        const double t = -distance * distance / (2.0 * variance);
+        if (v < t - rho) {
+            return static_cast<std::uint64_t>(k);
         }
-        if (total_ == 0.0) {
-            throw std::invalid_argument{
-                "PreparedWeightedIndex requires at least one positive weight"};
+        if (v > t + rho) {
+            continue;
+        }
+        const double remaining = n - k + 1.0;
+        const double bound = mode_correction +
+                             (n + 1.0) * std::log((n - mode + 1.0) / remaining) +
+                             (k + 0.5) * std::log(remaining * odds / (k + 1.0)) -
+                             stirling_correction(k) - stirling_correction(n - k);
+        if (v <= bound) {
+            return static_cast<std::uint64_t>(k);
         }
-        maximum_draw_ = std::nextafter(total_, 0.0);
     }
+}
 
-    std::vector<double> cumulative_;
-    double total_{0.0};
+inline constexpr double binomial_inversion_limit = 10.0;
+
+// Storm-owned binomial sampler. Uses only canonical draws and IEEE double
+// arithmetic with std::exp, std::log, and std::log1p, unlike
+// std::binomial_distribution whose algorithm varies between libraries.
+template<random_engine Engine>
+inline auto binomial(Engine& engine,
+                     const std::uint64_t trials,
+                     const double probability) noexcept -> std::uint64_t {
+    if (trials == 0 || probability <= 0.0) {
+        return 0;
+    }
+    if (probability >= 1.0) {
+        return trials;
+    }
+    const bool mirrored = probability > 0.5;
+    const double reduced = mirrored ? 1.0 - probability : probability;
+    const std::uint64_t successes =
+        static_cast<double>(trials) * reduced < binomial_inversion_limit
+            ? binomial_inversion(engine, trials, reduced)
+            : binomial_btrd(engine, trials, reduced);
+    const std::uint64_t bounded = std::min(successes, trials);
+    return mirrored ? trials - bounded : bounded;
+}
+
+// Conditional binomial multinomial: bucket i receives Binomial(remaining
+// draws, its weight over the weight not yet visited). Work is O(k) in the
+// number of buckets and independent of the number of draws.
+template<random_engine Engine>
+inline auto sample_cumulative_counts(Engine& engine,
+                                     const std::vector<double>& cumulative,
+                                     const std::uint64_t draws) -> std::vector<std::uint64_t> {
+    std::vector<std::uint64_t> counts(cumulative.size());
+    const double total = cumulative.back();
+    std::uint64_t remaining = draws;
+    double previous = 0.0;
+    for (std::size_t index = 0; index < cumulative.size() && remaining > 0; ++index) {
+        const double weight = cumulative[index] - previous;
+        const double unvisited = total - previous;
+        previous = cumulative[index];
+        if (weight <= 0.0) {
+            continue;
+        }
+        counts[index] = weight >= unvisited ? remaining
+                                            : binomial(engine, remaining, weight / unvisited);
+        remaining -= counts[index];
+    }
+    return counts;
+}
+
+inline constexpr auto subtract_modulo(const std::size_t value,
+                                      const std::size_t decrement,
+                                      const std::size_t modulus) noexcept -> std::size_t {
+    const std::size_t reduced_decrement = decrement % modulus;
+    if (value >= reduced_decrement) {
+        return value - reduced_decrement;
+    }
+    return modulus - (reduced_decrement - value);
+}
+
+}  // namespace detail
+
+// Blackman and Vigna's xoshiro256++ 1.0: 32 bytes of state, period 2^256 - 1,
+// and a few shifts, rotations, and one addition per value.
+class xoshiro256pp {
+public:
+    using result_type = std::uint64_t;
+
+    xoshiro256pp() noexcept : xoshiro256pp{0} {}
+    explicit xoshiro256pp(const result_type seed_value) noexcept { seed(seed_value); }
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    explicit xoshiro256pp(SeedSequence& sequence) {
+        seed(sequence);
+    }
+
+    // Expands the seed with SplitMix64, which never yields four zero words.
+    void seed(const result_type seed_value) noexcept {
+        std::uint64_t expansion = seed_value;
+        for (std::uint64_t& word : state_) {
+            word = detail::splitmix64(expansion);
+        }
+    }
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    void seed(SeedSequence& sequence) {
+        std::array<std::uint32_t, 8> words{};
+        sequence.generate(words.begin(), words.end());
+        for (std::size_t index = 0; index < state_.size(); ++index) {
+            state_[index] = (static_cast<std::uint64_t>(words[2 * index]) << 32U) |
+                            words[(2 * index) + 1];
+        }
+        if (state_ == std::array<std::uint64_t, 4>{}) {
+            seed(0);
+        }
+    }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return 0; }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    auto operator()() noexcept -> result_type {
+        const std::uint64_t result = std::rotl(state_[0] + state_[3], 23) + state_[0];
+        const std::uint64_t shifted = state_[1] << 17U;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= shifted;
+        state_[3] = std::rotl(state_[3], 45);
+        return result;
+    }
+
+    void discard(unsigned long long count) noexcept {
+        for (; count > 0; --count) {
+            static_cast<void>((*this)());
+        }
+    }
+
+    friend auto operator==(const xoshiro256pp&, const xoshiro256pp&) -> bool = default;
+
+private:
+    std::array<std::uint64_t, 4> state_{};
+};
+
+// Steele, Lea, and Flood's SplitMix64 with Vigna's reference finalizer: one
+// word of state advanced by a fixed odd increment and mixed on output.
+// Construction scrambles the key with one finalizer step, so keys that differ
+// by the increment do not give shifted copies of one stream.
+class splitmix64 {
+public:
+    using result_type = std::uint64_t;
+
+    splitmix64() noexcept : splitmix64{0} {}
+    explicit splitmix64(const result_type seed_value) noexcept
+        : state_{detail::splitmix64_finalize(seed_value)} {}
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    explicit splitmix64(SeedSequence& sequence) {
+        seed(sequence);
+    }
+
+    void seed(const result_type seed_value) noexcept {
+        state_ = detail::splitmix64_finalize(seed_value);
+    }
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    void seed(SeedSequence& sequence) {
+        std::array<std::uint32_t, 2> words{};
+        sequence.generate(words.begin(), words.end());
+        state_ = (static_cast<std::uint64_t>(words[0]) << 32U) | words[1];
+    }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return 0; }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    auto operator()() noexcept -> result_type { return detail::splitmix64(state_); }
+
+    void discard(const unsigned long long count) noexcept { state_ += count * increment; }
+
+    friend auto operator==(const splitmix64&, const splitmix64&) -> bool = default;
+
+private:
+    static constexpr std::uint64_t increment = 0x9E37'79B9'7F4A'7C15ULL;
+
+    std::uint64_t state_ = 0;
+};
+
+namespace detail {
+
+// The MT19937-64 recurrence and tempering shared by block_mt19937_64 and jump.
+struct mt19937_64_parameters {
+    static constexpr std::size_t state_size = 312;
+    static constexpr std::size_t shift_size = 156;
+    static constexpr std::uint64_t matrix = 0xB502'6F5A'A966'19E9ULL;
+    static constexpr std::uint64_t upper_mask = ~std::uint64_t{0} << 31U;
+    static constexpr std::uint64_t lower_mask = ~upper_mask;
+    static constexpr std::uint64_t temper_d = 0x5555'5555'5555'5555ULL;
+    static constexpr std::uint64_t temper_b = 0x71D6'7FFF'EDA6'0000ULL;
+    static constexpr std::uint64_t temper_c = 0xFFF7'EEE0'0000'0000ULL;
+
+    static constexpr auto twist_word(const std::uint64_t current,
+                                     const std::uint64_t next,
+                                     const std::uint64_t far) noexcept -> std::uint64_t {
+        const std::uint64_t joined = (current & upper_mask) | (next & lower_mask);
+        return far ^ (joined >> 1U) ^ ((0 - (joined & 1U)) & matrix);
+    }
+
+    static constexpr auto temper(std::uint64_t value) noexcept -> std::uint64_t {
+        value ^= (value >> 29U) & temper_d;
+        value ^= (value << 17U) & temper_b;
+        value ^= (value << 37U) & temper_c;
+        return value ^ (value >> 43U);
+    }
+
+    // Undoes temper step by step. A shift of at least 32 is its own inverse;
+    // the shorter shifts recover a further 17 or 29 bits per pass.
+    static constexpr auto untemper(std::uint64_t value) noexcept -> std::uint64_t {
+        value ^= value >> 43U;
+        value ^= (value << 37U) & temper_c;
+        std::uint64_t recovered = value;
+        for (int pass = 0; pass < 3; ++pass) {
+            recovered = value ^ ((recovered << 17U) & temper_b);
+        }
+        value = recovered;
+        for (int pass = 0; pass < 2; ++pass) {
+            recovered = value ^ ((recovered >> 29U) & temper_d);
+        }
+        return recovered;
+    }
+};
+
+}  // namespace detail
+
+// Produces exactly std::mt19937_64's sequence for every seed and seed
+// sequence. Instead of twisting one word per call, it regenerates all 312
+// state words and tempers them into an output buffer at once, using AVX2 or
+// SSE2 when the translation unit is compiled for them.
+class block_mt19937_64 : private detail::mt19937_64_parameters {
+public:
+    using result_type = std::uint64_t;
+
+    using mt19937_64_parameters::state_size;
+    static constexpr result_type default_seed = 5489U;
+
+    block_mt19937_64() noexcept : block_mt19937_64{default_seed} {}
+    explicit block_mt19937_64(const result_type seed_value) noexcept { seed(seed_value); }
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    explicit block_mt19937_64(SeedSequence& sequence) {
+        seed(sequence);
+    }
+
+    void seed(const result_type seed_value) noexcept {
+        state_[0] = seed_value;
+        for (std::size_t index = 1; index < state_size; ++index) {
+            const std::uint64_t previous = state_[index - 1];
+            state_[index] = initialization_multiplier * (previous ^ (previous >> 62U)) + index;
+        }
+        index_ = state_size;
+    }
+
+    // Follows [rand.eng.mers]: two 32-bit words per state word, and a state
+    // whose significant bits are all zero is replaced by 2^63.
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    void seed(SeedSequence& sequence) {
+        std::array<std::uint32_t, 2 * state_size> words{};
+        sequence.generate(words.begin(), words.end());
+        bool zero = true;
+        for (std::size_t index = 0; index < state_size; ++index) {
+            state_[index] = words[2 * index] |
+                            (static_cast<std::uint64_t>(words[(2 * index) + 1]) << 32U);
+            zero = zero && (index == 0 ? (state_[0] & upper_mask) == 0 : state_[index] == 0);
+        }
+        if (zero) {
+            state_[0] = std::uint64_t{1} << 63U;
+        }
+        index_ = state_size;
+    }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return 0; }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    auto operator()() noexcept -> result_type {
+        if (index_ == state_size) {
+            refill();
+        }
+        return output_[index_++];
+    }
+
+    void discard(unsigned long long count) noexcept {
+        while (count > 0) {
+            if (index_ == state_size) {
+                refill();
+            }
+            const auto available = static_cast<unsigned long long>(state_size - index_);
+            const auto skipped = std::min(count, available);
+            index_ += static_cast<std::size_t>(skipped);
+            count -= skipped;
+        }
+    }
+
+    // The output buffer is a function of the state, so state and position
+    // determine the rest of the sequence.
+    friend auto operator==(const block_mt19937_64& left, const block_mt19937_64& right)
+        -> bool {
+        return left.index_ == right.index_ && left.state_ == right.state_;
+    }
+
+private:
+    static constexpr std::uint64_t initialization_multiplier = 6'364'136'223'846'793'005ULL;
+
+    // Twists words [first, last), reading word index + 1 and the word at the
+    // same distance from far. Callers keep every read either below first
+    // (already twisted, as the sequential recurrence requires) or at least
+    // last, and never let the far run wrap.
+    void twist(std::size_t first, const std::size_t last, std::size_t far) noexcept {
+        std::uint64_t* const state = state_.data();
+#if defined(__AVX2__)
+        const __m256i upper = _mm256_set1_epi64x(static_cast<long long>(upper_mask));
+        const __m256i lower = _mm256_set1_epi64x(static_cast<long long>(lower_mask));
+        const __m256i one = _mm256_set1_epi64x(1);
+        const __m256i twist_matrix = _mm256_set1_epi64x(static_cast<long long>(matrix));
+        for (const std::size_t end = last - ((last - first) % 4); first < end; first += 4) {
+            const __m256i current =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + first));
+            const __m256i next =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + first + 1));
+            const __m256i distant =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + far));
+            const __m256i joined = _mm256_or_si256(_mm256_and_si256(current, upper),
+                                                   _mm256_and_si256(next, lower));
+            const __m256i odd = _mm256_sub_epi64(_mm256_setzero_si256(),
+                                                 _mm256_and_si256(joined, one));
+            const __m256i result = _mm256_xor_si256(
+                _mm256_xor_si256(distant, _mm256_srli_epi64(joined, 1)),
+                _mm256_and_si256(odd, twist_matrix));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + first), result);
+            far += 4;
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128i upper = _mm_set1_epi64x(static_cast<long long>(upper_mask));
+        const __m128i lower = _mm_set1_epi64x(static_cast<long long>(lower_mask));
+        const __m128i one = _mm_set1_epi64x(1);
+        const __m128i twist_matrix = _mm_set1_epi64x(static_cast<long long>(matrix));
+        for (const std::size_t end = last - ((last - first) % 2); first < end; first += 2) {
+            const __m128i current =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + first));
+            const __m128i next =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + first + 1));
+            const __m128i distant = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + far));
+            const __m128i joined =
+                _mm_or_si128(_mm_and_si128(current, upper), _mm_and_si128(next, lower));
+            const __m128i odd = _mm_sub_epi64(_mm_setzero_si128(), _mm_and_si128(joined, one));
+            const __m128i result =
+                _mm_xor_si128(_mm_xor_si128(distant, _mm_srli_epi64(joined, 1)),
+                              _mm_and_si128(odd, twist_matrix));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(state + first), result);
+            far += 2;
+        }
+#endif
+        for (; first < last; ++first, ++far) {
+            state[first] = twist_word(state[first], state[first + 1], state[far]);
+        }
+    }
+
+    void temper_all() noexcept {
+        const std::uint64_t* const state = state_.data();
+        std::uint64_t* const output = output_.data();
+        static_assert(state_size % 4 == 0);
+#if defined(__AVX2__)
+        const __m256i d = _mm256_set1_epi64x(static_cast<long long>(temper_d));
+        const __m256i b = _mm256_set1_epi64x(static_cast<long long>(temper_b));
+        const __m256i c = _mm256_set1_epi64x(static_cast<long long>(temper_c));
+        for (std::size_t index = 0; index < state_size; index += 4) {
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + index));
+            value = _mm256_xor_si256(value, _mm256_and_si256(_mm256_srli_epi64(value, 29), d));
+            value = _mm256_xor_si256(value, _mm256_and_si256(_mm256_slli_epi64(value, 17), b));
+            value = _mm256_xor_si256(value, _mm256_and_si256(_mm256_slli_epi64(value, 37), c));
+            value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 43));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), value);
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128i d = _mm_set1_epi64x(static_cast<long long>(temper_d));
+        const __m128i b = _mm_set1_epi64x(static_cast<long long>(temper_b));
+        const __m128i c = _mm_set1_epi64x(static_cast<long long>(temper_c));
+        for (std::size_t index = 0; index < state_size; index += 2) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state + index));
+            value = _mm_xor_si128(value, _mm_and_si128(_mm_srli_epi64(value, 29), d));
+            value = _mm_xor_si128(value, _mm_and_si128(_mm_slli_epi64(value, 17), b));
+            value = _mm_xor_si128(value, _mm_and_si128(_mm_slli_epi64(value, 37), c));
+            value = _mm_xor_si128(value, _mm_srli_epi64(value, 43));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), value);
+        }
+#else
+        for (std::size_t index = 0; index < state_size; ++index) {
+            output[index] = temper(state[index]);
+        }
+#endif
+    }
+
+    // The recurrence for word i reads words i + 1 and i + 156 modulo 312.
+    // Words below 156 read only old words; words 156 to 310 read words that
+    // the first pass already replaced; word 311 wraps around to word 0.
+    void refill() noexcept {
+        constexpr std::size_t last = state_size - 1;
+        twist(0, state_size - shift_size, shift_size);
+        twist(state_size - shift_size, last, 0);
+        state_[last] = twist_word(state_[last], state_[0], state_[shift_size - 1]);
+        temper_all();
+        index_ = 0;
+    }
+
+    std::array<std::uint64_t, state_size> state_{};
+    std::array<std::uint64_t, state_size> output_{};
+    std::size_t index_ = state_size;
+};
+
+// Salmon et al.'s Philox4x64-10 counter-based generator from "Parallel random
+// numbers: as easy as 1, 2, 3" (SC 2011). Output p of a stream is word p % 4
+// of the block for counter p / 4, so seek and discard are O(1). The first key
+// word holds the seed and the second the stream id.
+class philox4x64 {
+public:
+    using result_type = std::uint64_t;
+    using counter_type = std::array<std::uint64_t, 4>;
+    using key_type = std::array<std::uint64_t, 2>;
+
+    static constexpr unsigned rounds = 10;
+
+    philox4x64() noexcept : philox4x64{0} {}
+    explicit philox4x64(const result_type seed_value, const std::uint64_t stream = 0) noexcept
+        : key_{seed_value, stream} {}
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    explicit philox4x64(SeedSequence& sequence) {
+        seed(sequence);
+    }
+
+    // Keeps the stream id and restarts at position zero.
+    void seed(const result_type seed_value) noexcept {
+        key_[0] = seed_value;
+        seek(0);
+    }
+
+    template<typename SeedSequence>
+        requires(!std::convertible_to<SeedSequence, result_type>)
+    void seed(SeedSequence& sequence) {
+        std::array<std::uint32_t, 4> words{};
+        sequence.generate(words.begin(), words.end());
+        key_ = {(static_cast<std::uint64_t>(words[0]) << 32U) | words[1],
+                (static_cast<std::uint64_t>(words[2]) << 32U) | words[3]};
+        seek(0);
+    }
+
+    // Positions the engine so that the next value is output number position
+    // of the current stream.
+    void seek(const std::uint64_t position) noexcept {
+        counter_ = {position >> 2U, 0, 0, 0};
+        set_lane(position & 3U);
+    }
+
+    [[nodiscard]] auto stream() const noexcept -> std::uint64_t { return key_[1]; }
+
+    [[nodiscard]] static constexpr auto min() noexcept -> result_type { return 0; }
+    [[nodiscard]] static constexpr auto max() noexcept -> result_type {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    auto operator()() noexcept -> result_type {
+        if (lane_ == 0) {
+            block_ = generate(counter_, key_);
+        }
+        const result_type value = block_[lane_];
+        if (++lane_ == block_.size()) {
+            lane_ = 0;
+            advance(1);
+        }
+        return value;
+    }
+
+    void discard(const unsigned long long count) noexcept {
+        const std::uint64_t lane = lane_ + (count & 3U);
+        advance((count >> 2U) + (lane >> 2U));
+        set_lane(lane & 3U);
+    }
+
+    // The Philox4x64-10 bijection of one counter block under one key.
+    [[nodiscard]] static constexpr auto generate(counter_type counter, key_type key) noexcept
+        -> counter_type {
+        for (unsigned round = 0; round < rounds; ++round) {
+            if (round != 0) {
+                key[0] += weyl_0;
+                key[1] += weyl_1;
+            }
+            std::uint64_t low_0 = 0;
+            std::uint64_t low_1 = 0;
+            const std::uint64_t high_0 = detail::multiply_wide(multiplier_0, counter[0], low_0);
+            const std::uint64_t high_1 = detail::multiply_wide(multiplier_1, counter[2], low_1);
+            counter = {high_1 ^ counter[1] ^ key[0], low_1, high_0 ^ counter[3] ^ key[1], low_0};
+        }
+        return counter;
+    }
+
+    friend auto operator==(const philox4x64& left, const philox4x64& right) -> bool {
+        return left.key_ == right.key_ && left.counter_ == right.counter_ &&
+               left.lane_ == right.lane_;
+    }
+
+private:
+    static constexpr std::uint64_t multiplier_0 = 0xD2E7'470E'E14C'6C93ULL;
+    static constexpr std::uint64_t multiplier_1 = 0xCA5A'8263'9512'1157ULL;
+    static constexpr std::uint64_t weyl_0 = 0x9E37'79B9'7F4A'7C15ULL;
+    static constexpr std::uint64_t weyl_1 = 0xBB67'AE85'84CA'A73BULL;
+
+    // Adds to the 256-bit counter, carrying between words.
+    void advance(const std::uint64_t blocks) noexcept {
+        counter_[0] += blocks;
+        bool carry = counter_[0] < blocks;
+        for (std::size_t word = 1; carry && word < counter_.size(); ++word) {
+            ++counter_[word];
+            carry = counter_[word] == 0;
+        }
+    }
+
+    // The block buffer is valid whenever the lane is nonzero.
+    void set_lane(const std::uint64_t lane) noexcept {
+        lane_ = static_cast<std::size_t>(lane);
+        if (lane_ != 0) {
+            block_ = generate(counter_, key_);
+        }
+    }
+
+    key_type key_{};
+    counter_type counter_{};
+    counter_type block_{};
+    std::size_t lane_ = 0;
+};
+
+namespace detail {
+
+// Jumps use the characteristic polynomial of the MT19937-64 recurrence, as in
+// Haramoto et al., "Efficient Jump Ahead for F2-Linear Random Number
+// Generators" (2008): advancing by s outputs applies x^s modulo that
+// polynomial to the state. Coefficient i of a polynomial is bit i % 64 of
+// word i / 64.
+inline constexpr std::size_t mt19937_64_degree = 19937;
+using mt19937_64_polynomial = std::array<std::uint64_t, mt19937_64_parameters::state_size>;
+using mt19937_64_window = std::array<std::uint64_t, mt19937_64_parameters::state_size>;
+
+// The exponents of the characteristic polynomial below its leading x^19937,
+// found with Berlekamp-Massey on the low output bit.
+inline constexpr std::array<std::uint16_t, 284> mt19937_64_characteristic_terms{
+    0, 312, 468, 1092, 1248, 1716, 1872, 2028, 2496, 2652, 2808, 3120,
+    3276, 3432, 3588, 3900, 4056, 4368, 4680, 4992, 5303, 5460, 5613, 5615,
+    5616, 6078, 6084, 6234, 6237, 6240, 6388, 6390, 6396, 6543, 6544, 6546,
+    6552, 6702, 6855, 6858, 6864, 7008, 7014, 7163, 7164, 7170, 7176, 7475,
+    7632, 7636, 7644, 7787, 7788, 7791, 7792, 7938, 7956, 8093, 8094, 8099,
+    8103, 8112, 8250, 8256, 8268, 8406, 8411, 8412, 8558, 8713, 8714, 8717,
+    8723, 8868, 8870, 8880, 9023, 9024, 9026, 9035, 9036, 9048, 9182, 9333,
+    9335, 9338, 9347, 9360, 9494, 9650, 9798, 9953, 9954, 9957, 9961, 9984,
+    10110, 10116, 10266, 10271, 10272, 10295, 10422, 10434, 10578, 10581, 10583, 10589,
+    10590, 10605, 10607, 10734, 10746, 10890, 10902, 11046, 11054, 11070, 11202, 11205,
+    11209, 11210, 11213, 11226, 11229, 11358, 11364, 11366, 11380, 11382, 11514, 11519,
+    11520, 11522, 11535, 11536, 11538, 11670, 11678, 11694, 11826, 11829, 11831, 11834,
+    11847, 11850, 11982, 11990, 12000, 12006, 12138, 12146, 12155, 12156, 12162, 12294,
+    12450, 12453, 12457, 12467, 12606, 12612, 12624, 12628, 12762, 12767, 12768, 12779,
+    12780, 12783, 12784, 12918, 12930, 13074, 13077, 13079, 13085, 13086, 13091, 13095,
+    13230, 13242, 13248, 13386, 13398, 13403, 13404, 13542, 13550, 13698, 13701, 13705,
+    13706, 13709, 13715, 13854, 13860, 13862, 13872, 14010, 14015, 14016, 14018, 14027,
+    14028, 14166, 14174, 14322, 14325, 14327, 14330, 14339, 14478, 14486, 14634, 14642,
+    14790, 14946, 14949, 14953, 15102, 15108, 15258, 15263, 15264, 15414, 15426, 15570,
+    15573, 15575, 15581, 15582, 15726, 15738, 15882, 15894, 16038, 16046, 16194, 16197,
+    16201, 16202, 16205, 16350, 16356, 16358, 16506, 16511, 16512, 16514, 16662, 16670,
+    16818, 16821, 16823, 16826, 16974, 16982, 17130, 17138, 17286, 17442, 17445, 17449,
+    17598, 17604, 17754, 17759, 17760, 17910, 18066, 18069, 18071, 18222, 18378, 18534,
+    18690, 18693, 18846, 19002, 19158, 19314, 19470, 19626,
+};
+
+// x^(2^128 - 312) modulo the characteristic polynomial, the jump_substream
+// polynomial for apply_mt19937_64_jump.
+inline constexpr mt19937_64_polynomial mt19937_64_substream_jump{
+    0xE5262EDB3947384FULL, 0xE8DBE8BC6168161DULL, 0x552A7F8A909E5996ULL, 0x7AE186FE858D9ADAULL,
+    0xA626D3D5C3C9781EULL, 0x98F5550062247FCBULL, 0x5B0A34A4146A34F2ULL, 0xD35659725684F831ULL,
+    0xB79DB1F77395F208ULL, 0xF5C348A32CECAC5CULL, 0x58CC38B6123ED794ULL, 0xD191A00B3E362C4BULL,
+    0xFED421B5A1B55964ULL, 0x89BCC240E26E3328ULL, 0x06DC4E1C13CC03A7ULL, 0x92188467E9A1E6DEULL,
+    0xAC0427A245A59975ULL, 0x396D921AD8BA9AC5ULL, 0xB7F21F270E15160EULL, 0x28A2A3D46BE04DAAULL,
+    0x815EEB2E91AA0550ULL, 0xBA386F6309E7DDD0ULL, 0x7AA2D3CB29FFF2CAULL, 0xC62EB2F81D8634DAULL,
+    0x6CFE9B7DD64A679AULL, 0xC3BD22442119535CULL, 0x902A73A39384E1A2ULL, 0xF5EDDF0CE5AF27D4ULL,
+    0xE7DE5E359401F618ULL, 0xC4524F942F884D2FULL, 0x3857B7FB97649EB1ULL, 0x930CD5A1830B9DE8ULL,
+    0x305413C76BA04ACBULL, 0xED61BA7DFC907582ULL, 0xC3C984C6070A6C88ULL, 0xC31B486A6B91E7CBULL,
+    0x6147E50886F57AB4ULL, 0xB611DBE934CB0FA4ULL, 0x5246952DD7012A63ULL, 0xF1B2BE7B6814B670ULL,
+    0x215CA6E78D45A034ULL, 0x2B674AE10418B5EBULL, 0xB65BD80D3FD8DAC7ULL, 0xBC0C6A9B5E0F1B2FULL,
+    0x0C7BC0F20C26BC77ULL, 0xDD1343F069FA597CULL, 0xFCDF6EF10C69BC36ULL, 0xE2ECE971A260F1F6ULL,
+    0x7E1DB9A5DE8F0156ULL, 0xEC78EF6CC9859BC2ULL, 0xD31E5094309694D1ULL, 0xCBE7BECDD0314DB4ULL,
+    0x4A8B310699F06AF8ULL, 0x13921DD25AC16686ULL, 0x9A7D929F9B7FAA1EULL, 0x247B5921C1DACDE0ULL,
+    0x08885F6FA9F9B2F4ULL, 0x32273406A986F2AEULL, 0x68E8F62142A110BFULL, 0x9496AAD678097737ULL,
+    0x52514E868848B1E4ULL, 0x5AC11875E31451B5ULL, 0xC3D01326BD3B4B0BULL, 0x3A5CE9B2CCF55BF9ULL,
+    0x57C454DE7415D6EBULL, 0x0A46EB592B1E519DULL, 0xF5F765AF1E7188F7ULL, 0x94EF0AC12148F809ULL,
+    0x89A7E4B40449F815ULL, 0x9C2FCF91EBCA5C18ULL, 0x03B721F5217E7BBCULL, 0xA7E1373738DF8240ULL,
+    0x6A7C07B8E3C9332CULL, 0x7DFC2444E92F2A82ULL, 0xC0EF98F68F155A80ULL, 0x7820609167F2D4FFULL,
+    0x01A3442E33CE6F4BULL, 0xC40B57D98D7F8EF5ULL, 0x2E852E98D8BE63EAULL, 0xA5C06667AFB32C88ULL,
+    0x61FF578FDF9D6FDCULL, 0xEFEA3C06B708D19BULL, 0x24BDAEBE6B0C2AFDULL, 0xCC88EC820EAC0FCDULL,
+    0x8E1F9260758339A6ULL, 0xA9ACAE9C292C4124ULL, 0x3032D1CBB31CF5D4ULL, 0x4B574390715C5AD7ULL,
+    0x6F6F5F354266DF76ULL, 0xC4150013CC941292ULL, 0xA0B53044DBE91A60ULL, 0x30635D3AE8D785ECULL,
+    0x8202F63E3E107FADULL, 0xCB476EE8688E0BCBULL, 0xE4591E05B8E036A2ULL, 0xBD6DBFFC959C33E3ULL,
+    0xC93A20B1CD9BA6ECULL, 0xC4CA906E69CC2D92ULL, 0x6A9BBC5B1DBB93F5ULL, 0x67500782BD1B7E9EULL,
+    0x6AC1F7F27535ECC3ULL, 0x5223B3178995C738ULL, 0x2A3D81343948075AULL, 0xE38FCACA1599F828ULL,
+    0xBB1A24593DCFE24BULL, 0xA12B84186C45B364ULL, 0xAB0109868EEA202AULL, 0x8DF9B96A9752E935ULL,
+    0x0CC28C8A24670058ULL, 0x8658AA03FD5820CFULL, 0xB7907411D0B0872CULL, 0x01A19DAF25F30B3CULL,
+    0x2DDC019588BE4530ULL, 0x812F0DF2F0AEF518ULL, 0x15402344FFA07AD9ULL, 0xD335A4B06BCAE030ULL,
+    0x816A0E0C6CBB7ABAULL, 0x766A9B19E52B6A38ULL, 0x1C3B7AF26281F0E8ULL, 0xE01913830022AC78ULL,
+    0x8B7BF04881A1A1CEULL, 0x404D5BF0CFA62DA1ULL, 0xB609D2FAE7C762B1ULL, 0x0797289CCA0D3675ULL,
+    0x5AD3FB6418E4CC33ULL, 0xBBAFA0647E61AFF6ULL, 0x9F507106EE45C37EULL, 0x148A81FE5D0A6907ULL,
+    0x73768DF926A7F6D4ULL, 0xB5C7A7027D003647ULL, 0x1071E3F43FB3FE3FULL, 0xF47F8F20F7907AB8ULL,
+    0x0AD3A01C017DD483ULL, 0xEA28979265A6A458ULL, 0x4B217F895D792A6DULL, 0xAA7E96A66BF4A9F7ULL,
+    0x34B398AABC021B06ULL, 0x033AD4E061B705F6ULL, 0x5EE2BF91C2EA9E1DULL, 0x8FB2F08479D39D07ULL,
+    0xA668CB9B9BAAA7FFULL, 0x258EF3C71932DB78ULL, 0xA4FDDAC73138CFDFULL, 0xB39A176AA98BA349ULL,
+    0x4E3D8A45557BDBC0ULL, 0x00939204C831E5C7ULL, 0xBDE0050F5D3B6C22ULL, 0x321D94C01B34156FULL,
+    0xFFB57FC1752B3D49ULL, 0x1EBA75AEF52776E4ULL, 0x18F24E8054A82DBCULL, 0x9A88388E9AF3BC65ULL,
+    0x15F9895D23793BF2ULL, 0x7089A4F12E283439ULL, 0x6FE2544F83C4997BULL, 0xD837C9FA3346F327ULL,
+    0x1616EC2DD8A25ECBULL, 0x0F003BBFDA576878ULL, 0x750E58812D2255A2ULL, 0x394F818BE9AEFF08ULL,
+    0xEEE31FDF2BCEA017ULL, 0x2AE89C6E158F3FDCULL, 0x2A2ED38677470038ULL, 0x546FCE260192AAE2ULL,
+    0x7F2AB6157ABDD217ULL, 0x0B3A4A0323A2874EULL, 0xB23BEF7C196387CEULL, 0xEFB5418B1A20904CULL,
+    0x59D2311628820E65ULL, 0xCA7A23DDFD16129DULL, 0x3CC081156E1CAFB6ULL, 0x61D67D0A38529BEAULL,
+    0x3E94276CCBD611AAULL, 0x3771F3B213DE600AULL, 0x21E00BBED986F832ULL, 0x3EC36E342578BEF4ULL,
+    0xC249F0A082B2C6BBULL, 0x78467F961407157CULL, 0x0D04371569691E5EULL, 0x3D542ACBCFEC7D0FULL,
+    0xAE1E5EE563F709EFULL, 0x72DC126DB599BA74ULL, 0xDFEAB969FE872BC3ULL, 0x321101F23C5CD2A7ULL,
+    0x17DBA0F541DB11B5ULL, 0x9568E6CB91205C85ULL, 0xBAD64ECE4A1D6354ULL, 0x1F40BFAB48C9427AULL,
+    0x469366DDDCEDB23FULL, 0xB8C9BBC8FD17A879ULL, 0x881FF11AC4FBB3A7ULL, 0xA0B1D5AC0C7A578CULL,
+    0x2C93743EFA9E9706ULL, 0x655D05B5ECF0A9EDULL, 0x53695E0FA22A9D74ULL, 0x335BB8E887C19B1FULL,
+    0xF4F3609D40423274ULL, 0x82F568C2121DEB57ULL, 0x8B3141721391FC28ULL, 0xCCE30200B768469FULL,
+    0x3C49361C58DF6C54ULL, 0x749ABB2739D7E821ULL, 0x8E3FB1739BB024C9ULL, 0x053FF0D5A2385C26ULL,
+    0x7FC3F3500BE6B460ULL, 0xEA4A53187E13D377ULL, 0xB830796D57008DF2ULL, 0x3FAC39E03D15C8EBULL,
+    0x149EBFBF9371F5EFULL, 0xC9A3DAADA4C3B184ULL, 0xC73586121B2B22F9ULL, 0x8C74CB2A142CAE6EULL,
+    0x71E079AA37334E9EULL, 0x69599461D3C9525FULL, 0xF21324943980CFFAULL, 0xE5EF3C6EB18325CCULL,
+    0x68C7ECE59676D433ULL, 0x057ECFAA0CF8C9E6ULL, 0xB6A5E05F8247D5E9ULL, 0xA5AF46E888104205ULL,
+    0x29E0C8436CDD6301ULL, 0x2F57593904BA61D3ULL, 0xD67ABFFA9773FDD3ULL, 0x2AC6A9EA01C9E370ULL,
+    0x089B5CAEFABA0AC3ULL, 0x72FDD9F2A770AA93ULL, 0xC529FFF58E1EE093ULL, 0xE7AE2809097EA6FFULL,
+    0xF645F5AE7384B63FULL, 0xE176641A400E5C76ULL, 0x619940EB0AA9168AULL, 0x46E31DDC7BDFF59BULL,
+    0x15FDA081CC260B7EULL, 0x0E446449DDB03A45ULL, 0x196780A4C106F14EULL, 0x725EBC1EF9D6EEBFULL,
+    0x023AED700BB72FDCULL, 0x9ECECFE062F75384ULL, 0x823AC874CED22CC7ULL, 0xC382DE09D280FD06ULL,
+    0x01C28526F13E350DULL, 0x09CBECA4CBFFF94FULL, 0x5857F8CD86826440ULL, 0xC79B041DF499F29EULL,
+    0x7858020137A7BB94ULL, 0x51DB6F9855926972ULL, 0xA86EC1F4423D4175ULL, 0x9CB08B217C241386ULL,
+    0x87707DE358526B57ULL, 0x896999D1219EE796ULL, 0xB317A4339B9FCFA6ULL, 0xC7B19CEBE2CCFAC9ULL,
+    0x40B734DFEAE00C34ULL, 0xF22CEBF88D47C529ULL, 0x00AC8A2CB14C4E72ULL, 0xC15B3E21A8E71185ULL,
+    0x110CF443071EABBCULL, 0x0DF93EEB4277A0AEULL, 0xF613B204858ED3F0ULL, 0xAB830B18776D9C37ULL,
+    0xF5F99B412BF70BEBULL, 0x2B00277E9DF35221ULL, 0x1E836A42EC71A14BULL, 0x459F153816488DE4ULL,
+    0x438076134C818AFDULL, 0xA2E30EB79384539DULL, 0x8BF18A4CDFAB9EB2ULL, 0x9776FC6AFEEBB940ULL,
+    0xD0DF30D8D681F6C5ULL, 0xE9180ABCA98459FEULL, 0x02AD70F7A14CCED3ULL, 0x86248BE8D8A7E866ULL,
+    0xCB5A108171B2AEDFULL, 0x7606A59C346B5B13ULL, 0x2357668C2CEBA1E9ULL, 0x7A45D842DFB1AF12ULL,
+    0x85EACD9FCB1DFBDDULL, 0xE56C43182E344824ULL, 0x0ED1B51DF09E1899ULL, 0x169F9B476B6C1BBCULL,
+    0x76754F21A5CD8869ULL, 0x3BF0A0CE9B6717BEULL, 0xF8B24B3574EC1F59ULL, 0x637219371EE79E42ULL,
+    0x3C0E7B7FDA30AD4EULL, 0x4DAEC06898C72E2DULL, 0xE1115506FEA1D7E2ULL, 0xAA1E2FDC12FB1752ULL,
+    0x83C09F42977F41BFULL, 0xEEE2C742C6837A46ULL, 0x7CA1114BD92435C5ULL, 0xA121641B4DD2DD77ULL,
+    0xDE359F7D9C1F27D0ULL, 0x6B95FDC2F2DFDB41ULL, 0x3F06382069FC5218ULL, 0x15DD4512D1E94680ULL,
+    0x4698155B1804AD9AULL, 0x21E3613A2044352AULL, 0x0978A939EBEF57E2ULL, 0x80F7EDA58A2A8CBBULL,
+    0x484F64391CCB4A2CULL, 0xF5F31BEB102E348CULL, 0xF19E5D2976A54D82ULL, 0x1F73C7E9DDF3256FULL,
+    0xCDDC16EF95B0DA1FULL, 0xD9E4DAC42606845CULL, 0x363C63D4CFC368E3ULL, 0x398F7C2A7F784681ULL,
+    0xAAE7C371AB145DF8ULL, 0x644EA809991BED7AULL, 0x4F1D9F1C3733ADD4ULL, 0x000000014B915623ULL,
+};
+
+[[nodiscard]] inline auto read_bits(const std::span<const std::uint64_t> words,
+                                    const std::size_t position) noexcept -> std::uint64_t {
+    const std::size_t word = position / 64;
+    const auto offset = static_cast<unsigned>(position % 64);
+    if (offset == 0) {
+        return words[word];
+    }
+    return (words[word] >> offset) | (words[word + 1] << (64U - offset));
+}
+
+inline void xor_bits(const std::span<std::uint64_t> words,
+                     const std::size_t position,
+                     const std::uint64_t value) noexcept {
+    const std::size_t word = position / 64;
+    const auto offset = static_cast<unsigned>(position % 64);
+    words[word] ^= value << offset;
+    if (offset != 0) {
+        words[word + 1] ^= value >> (64U - offset);
+    }
+}
+
+[[nodiscard]] constexpr auto spread_bits(const std::uint32_t half) noexcept -> std::uint64_t {
+    std::uint64_t value = half;
+    value = (value | (value << 16U)) & 0x0000'FFFF'0000'FFFFULL;
+    value = (value | (value << 8U)) & 0x00FF'00FF'00FF'00FFULL;
+    value = (value | (value << 4U)) & 0x0F0F'0F0F'0F0F'0F0FULL;
+    value = (value | (value << 2U)) & 0x3333'3333'3333'3333ULL;
+    return (value | (value << 1U)) & 0x5555'5555'5555'5555ULL;
+}
+
+inline void mt19937_64_multiply_x(mt19937_64_polynomial& polynomial) noexcept {
+    std::uint64_t carry = 0;
+    for (std::uint64_t& word : polynomial) {
+        const std::uint64_t next_carry = word >> 63U;
+        word = (word << 1U) | carry;
+        carry = next_carry;
+    }
+    const std::uint64_t leading = std::uint64_t{1} << (mt19937_64_degree % 64);
+    std::uint64_t& leading_word = polynomial[mt19937_64_degree / 64];
+    if ((leading_word & leading) != 0) {
+        leading_word ^= leading;
+        for (const std::uint16_t term : mt19937_64_characteristic_terms) {
+            polynomial[term / 64U] ^= std::uint64_t{1} << (term % 64U);
+        }
+    }
+}
+
+// Squaring over GF(2) spreads the coefficients to even exponents. The
+// reduction folds 64 coefficients at a time from the top; the characteristic
+// polynomial's terms all lie more than 64 below its degree, so a fold never
+// lands in the chunk it came from.
+inline void mt19937_64_square(mt19937_64_polynomial& polynomial) noexcept {
+    std::array<std::uint64_t, 2 * mt19937_64_parameters::state_size> square{};
+    for (std::size_t word = 0; word < polynomial.size(); ++word) {
+        square[2 * word] = spread_bits(static_cast<std::uint32_t>(polynomial[word]));
+        square[(2 * word) + 1] = spread_bits(static_cast<std::uint32_t>(polynomial[word] >> 32U));
+    }
+    constexpr std::size_t chunks = ((2 * (mt19937_64_degree - 1)) - mt19937_64_degree) / 64 + 1;
+    for (std::size_t chunk = chunks; chunk-- > 0;) {
+        const std::size_t position = mt19937_64_degree + (64 * chunk);
+        const std::uint64_t value = read_bits(square, position);
+        if (value == 0) {
+            continue;
+        }
+        xor_bits(square, position, value);
+        for (const std::uint16_t term : mt19937_64_characteristic_terms) {
+            xor_bits(square, term + (64 * chunk), value);
+        }
+    }
+    std::copy_n(square.begin(), polynomial.size(), polynomial.begin());
+}
+
+// x^exponent modulo the characteristic polynomial, by left-to-right square
+// and multiply.
+[[nodiscard]] inline auto mt19937_64_power(const std::uint64_t exponent) noexcept
+    -> mt19937_64_polynomial {
+    mt19937_64_polynomial power{};
+    power[0] = 1;
+    for (auto bit = static_cast<int>(std::bit_width(exponent)) - 1; bit >= 0; --bit) {
+        mt19937_64_square(power);
+        if (((exponent >> static_cast<unsigned>(bit)) & 1U) != 0) {
+            mt19937_64_multiply_x(power);
+        }
+    }
+    return power;
+}
+
+// Seed sequence carrying a jump window in the [rand.eng.mers] seed(q) word
+// layout; see docs/API-CONTRACTS.md.
+class mt19937_64_window_sequence {
+public:
+    using result_type = std::uint32_t;
+
+    mt19937_64_window_sequence() = default;
+
+    template<std::input_iterator Iterator>
+    mt19937_64_window_sequence(Iterator first, const Iterator last) {
+        for (; first != last; ++first) {
+            words_.push_back(static_cast<result_type>(*first));
+        }
+    }
+
+    template<typename Value>
+    mt19937_64_window_sequence(const std::initializer_list<Value> values)
+        : mt19937_64_window_sequence(values.begin(), values.end()) {}
+
+    explicit mt19937_64_window_sequence(const mt19937_64_window& window) {
+        words_.reserve(window.size() * 2);
+        for (const std::uint64_t word : window) {
+            words_.push_back(static_cast<result_type>(word));
+            words_.push_back(static_cast<result_type>(word >> 32U));
+        }
+    }
+
+    mt19937_64_window_sequence(const mt19937_64_window_sequence&) = delete;
+    auto operator=(const mt19937_64_window_sequence&) -> mt19937_64_window_sequence& = delete;
+
+    template<std::random_access_iterator Iterator>
+    void generate(Iterator first, const Iterator last) const {
+        for (std::size_t index = 0; first != last; ++first, ++index) {
+            *first = words_.empty() ? result_type{0} : words_[index % words_.size()];
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return words_.size(); }
+
+    template<std::output_iterator<result_type> Iterator>
+    void param(const Iterator output) const {
+        std::copy(words_.begin(), words_.end(), output);
+    }
+
+private:
+    std::vector<result_type> words_;
+};
+
+// Advances the engine by the jump polynomial's steps plus 312; see docs/API-CONTRACTS.md.
+template<typename Engine>
+void apply_mt19937_64_jump(Engine& engine, const mt19937_64_polynomial& jump) {
+    using parameters = mt19937_64_parameters;
+    constexpr std::size_t window_size = parameters::state_size;
+    constexpr std::size_t chunk_bits = 8;
+    constexpr std::size_t chunk_mask = (std::size_t{1} << chunk_bits) - 1;
+    constexpr std::size_t chunks = (mt19937_64_degree + chunk_bits - 1) / chunk_bits;
+    const auto extend = [](std::uint64_t* const words, const std::size_t count) noexcept {
+        for (std::size_t index = window_size; index < window_size + count; ++index) {
+            const std::size_t first = index - window_size;
+            words[index] = parameters::twist_word(
+                words[first], words[first + 1], words[first + parameters::shift_size]);
+        }
+    };
+
+    std::array<std::uint64_t, window_size + chunk_bits - 1> state{};
+    for (std::size_t index = 0; index < window_size; ++index) {
+        state[index] = parameters::untemper(engine());
+    }
+    extend(state.data(), chunk_bits - 1);
+    std::vector<std::uint64_t> table((chunk_mask + 1) * window_size);
+    for (std::size_t combination = 1; combination <= chunk_mask; ++combination) {
+        const std::uint64_t* const previous =
+            table.data() + ((combination & (combination - 1)) * window_size);
+        const std::uint64_t* const shifted =
+            state.data() + std::countr_zero(static_cast<unsigned>(combination));
+        std::uint64_t* const output = table.data() + (combination * window_size);
+        for (std::size_t index = 0; index < window_size; ++index) {
+            output[index] = previous[index] ^ shifted[index];
+        }
+    }
+
+    std::vector<std::uint64_t> sequence(window_size + ((chunks - 1) * chunk_bits));
+    std::uint64_t* window = sequence.data();
+    for (std::size_t chunk = chunks; chunk-- > 0;) {
+        if (chunk + 1 != chunks) {
+            extend(window, chunk_bits);
+            window += chunk_bits;
+        }
+        const std::size_t bit = chunk * chunk_bits;
+        const auto combination =
+            static_cast<std::size_t>(jump[bit / 64] >> (bit % 64)) & chunk_mask;
+        if (combination != 0) {
+            const std::uint64_t* const source = table.data() + (combination * window_size);
+            for (std::size_t index = 0; index < window_size; ++index) {
+                window[index] ^= source[index];
+            }
+        }
+    }
+    mt19937_64_window result{};
+    std::copy_n(window, window_size, result.begin());
+    mt19937_64_window_sequence window_sequence(result);
+    engine.seed(window_sequence);
+}
+
+template<typename Engine>
+void jump_mt19937_64(Engine& engine, const std::uint64_t steps) {
+    constexpr std::uint64_t window_size = mt19937_64_parameters::state_size;
+    if (steps < window_size) {
+        engine.discard(steps);
+        return;
+    }
+    apply_mt19937_64_jump(engine, mt19937_64_power(steps - window_size));
+}
+
+}  // namespace detail
+
+// Owns one engine. Copying a generator copies its state and forks the sequence.
+template<random_engine Engine>
+class BasicGenerator {
+public:
+    using engine_type = Engine;
+
+    explicit BasicGenerator(const std::uint64_t seed_value = 0) : engine_{seed_value} {}
+
+    [[nodiscard]] auto engine() noexcept -> Engine& { return engine_; }
+    [[nodiscard]] auto engine() const noexcept -> const Engine& { return engine_; }
+    void seed(const std::uint64_t seed_value) { engine_.seed(seed_value); }
+    void reseed_from_entropy() { detail::seed_from_entropy(engine_); }
+
+private:
+    Engine engine_;
+};
+
+// A distinct class rather than an alias so that forward declarations of
+// Storm::Generator keep compiling.
+class Generator : public BasicGenerator<engine_type> {
+public:
+    using BasicGenerator::BasicGenerator;
+};
+
+using FastGenerator = BasicGenerator<xoshiro256pp>;
+using KeyedGenerator = BasicGenerator<splitmix64>;
+using BlockGenerator = BasicGenerator<block_mt19937_64>;
+using CounterGenerator = BasicGenerator<philox4x64>;
+
+// Advances the engine exactly as discard(steps) would. The cost grows with
+// the bit length of steps, not with steps, and stays near ten milliseconds.
+inline void jump(engine_type& engine, const std::uint64_t steps) {
+    detail::jump_mt19937_64(engine, steps);
+}
+
+inline void jump(block_mt19937_64& engine, const std::uint64_t steps) {
+    detail::jump_mt19937_64(engine, steps);
+}
+
+// Advances the engine by 2^128 outputs with a precomputed polynomial, in well
+// under a millisecond. Jumping copies of one generator 1, 2, 3, ... times
+// gives reproducible substreams that cannot overlap within 2^128 draws.
+inline void jump_substream(engine_type& engine) {
+    detail::apply_mt19937_64_jump(engine, detail::mt19937_64_substream_jump);
+}
+
+inline void jump_substream(block_mt19937_64& engine) {
+    detail::apply_mt19937_64_jump(engine, detail::mt19937_64_substream_jump);
+}
+
+// Lazily constructed engines, stream i seeded only from the master seed and i.
+template<random_engine Engine>
+    requires std::constructible_from<Engine, std::seed_seq&>
+class BasicStreamSet {
+public:
+    using engine_type = Engine;
+
+    BasicStreamSet(const std::uint64_t master_seed, const std::size_t count)
+        : slots_(count), master_seed_{master_seed} {}
+
+    BasicStreamSet(const BasicStreamSet&) = delete;
+    BasicStreamSet(BasicStreamSet&&) noexcept = default;
+    auto operator=(const BasicStreamSet&) -> BasicStreamSet& = delete;
+    auto operator=(BasicStreamSet&&) noexcept -> BasicStreamSet& = default;
+    ~BasicStreamSet() = default;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return slots_.size(); }
+    [[nodiscard]] auto master_seed() const noexcept -> std::uint64_t { return master_seed_; }
+
+    // Requires stream < size().
+    [[nodiscard]] auto operator[](const std::size_t stream) -> Engine& {
+        std::unique_ptr<slot>& entry = slots_[stream];
+        if (!entry) {
+            std::seed_seq sequence{detail::low_word(master_seed_), detail::high_word(master_seed_),
+                                   detail::low_word(stream), detail::high_word(stream)};
+            entry = std::make_unique<slot>(sequence);
+        }
+        return entry->engine;
+    }
+
+    [[nodiscard]] auto at(const std::size_t stream) -> Engine& {
+        if (stream >= slots_.size()) {
+            throw std::out_of_range{"BasicStreamSet stream is out of range"};
+        }
+        return (*this)[stream];
+    }
+
+private:
+    struct alignas(detail::cache_line_size) slot {
+        explicit slot(std::seed_seq& sequence) : engine{sequence} {}
+
+        Engine engine;
+    };
+
+    std::vector<std::unique_ptr<slot>> slots_;
+    std::uint64_t master_seed_;
+};
+
+using StreamSet = BasicStreamSet<engine_type>;
+
+[[nodiscard]] inline auto thread_engine() -> engine_type& {
+    // Deterministic initialization, including seed zero, is part of Storm's public contract.
+    thread_local engine_type engine{0};  // NOLINT(cert-msc51-cpp)
+    return engine;
+}
+
+inline void seed(const std::uint64_t seed_value) { thread_engine().seed(seed_value); }
+inline void reseed_from_entropy() { detail::seed_from_entropy(thread_engine()); }
+
+template<random_engine Engine>
+inline auto canonical(Engine& engine) noexcept -> double {
+    return detail::canonical_draw(engine);
+}
+
+inline auto canonical() -> double { return canonical(thread_engine()); }
+
+class PreparedWeightedIndex {
+public:
+    explicit PreparedWeightedIndex(const std::initializer_list<double> weights,
+                                   const cumulative_layout layout = cumulative_layout::sorted) {
+        cumulative_.reserve(weights.size());
+        initialize(weights.begin(), weights.end());
+        prepare_layout(layout);
+    }
+
+    template<std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
+    explicit PreparedWeightedIndex(Range&& weights,
+                                   const cumulative_layout layout = cumulative_layout::sorted) {
+        if constexpr (std::ranges::sized_range<Range>) {
+            cumulative_.reserve(static_cast<std::size_t>(std::ranges::size(weights)));
+        }
+        initialize(std::ranges::begin(weights), std::ranges::end(weights));
+        prepare_layout(layout);
+    }
+
+    explicit PreparedWeightedIndex(const std::initializer_list<double> weights,
+                                   const guide_table guide) {
+        detail::validate_guide_table(guide, "PreparedWeightedIndex");
+        cumulative_.reserve(weights.size());
+        initialize(weights.begin(), weights.end());
+        search_.guide = detail::guide_index{cumulative_, total_, guide.cutpoints};
+    }
+
+    template<std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
+    explicit PreparedWeightedIndex(Range&& weights, const guide_table guide) {
+        detail::validate_guide_table(guide, "PreparedWeightedIndex");
+        if constexpr (std::ranges::sized_range<Range>) {
+            cumulative_.reserve(static_cast<std::size_t>(std::ranges::size(weights)));
+        }
+        initialize(std::ranges::begin(weights), std::ranges::end(weights));
+        search_.guide = detail::guide_index{cumulative_, total_, guide.cutpoints};
+    }
+
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const -> std::size_t {
+        return detail::select_prepared_weighted_index(
+            engine, cumulative_, search_, total_, maximum_draw_);
+    }
+
+    template<random_engine Engine>
+    void select_many(Engine& engine, const std::span<std::size_t> output) const {
+        detail::select_prepared_weighted_indices(
+            engine, cumulative_, search_, total_, maximum_draw_, output);
+    }
+
+    template<random_engine Engine>
+    [[nodiscard]] auto sample_counts(Engine& engine, const std::uint64_t draws) const
+        -> std::vector<std::uint64_t> {
+        return detail::sample_cumulative_counts(engine, cumulative_, draws);
+    }
+
+private:
+    template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        requires std::convertible_to<std::iter_reference_t<Iterator>, double>
+    void initialize(Iterator first, const Sentinel last) {
+        for (; first != last; ++first) {
+            total_ = detail::add_validated_weight(
+                total_, static_cast<double>(*first), "PreparedWeightedIndex");
+            cumulative_.push_back(total_);
+        }
+        detail::validate_weight_total(cumulative_.size(), total_, "PreparedWeightedIndex");
+        maximum_draw_ = std::nextafter(total_, 0.0);
+    }
+
+    void prepare_layout(const cumulative_layout layout) {
+        if (layout == cumulative_layout::eytzinger) {
+            search_.eytzinger = detail::eytzinger_index{cumulative_};
+        }
+    }
+
+    std::vector<double> cumulative_;
+    detail::prepared_search search_;
+    double total_{0.0};
     double maximum_draw_{0.0};
 };
 
-class PreparedCumulativeWeightedIndex {
-public:
+class PreparedCumulativeWeightedIndex {
+public:
+    explicit PreparedCumulativeWeightedIndex(
+        const std::initializer_list<double> cumulative_boundaries,
+        const cumulative_layout layout = cumulative_layout::sorted) {
+        cumulative_.reserve(cumulative_boundaries.size());
+        initialize(cumulative_boundaries.begin(), cumulative_boundaries.end());
+        prepare_layout(layout);
+    }
+
+    template<std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
+    explicit PreparedCumulativeWeightedIndex(
+        Range&& cumulative_boundaries,
+        const cumulative_layout layout = cumulative_layout::sorted) {
+        if constexpr (std::ranges::sized_range<Range>) {
+            cumulative_.reserve(
+                static_cast<std::size_t>(std::ranges::size(cumulative_boundaries)));
+        }
+        initialize(std::ranges::begin(cumulative_boundaries),
+                   std::ranges::end(cumulative_boundaries));
+        prepare_layout(layout);
+    }
+
     explicit PreparedCumulativeWeightedIndex(
-        const std::initializer_list<double> cumulative_boundaries) {
+        const std::initializer_list<double> cumulative_boundaries, const guide_table guide) {
+        detail::validate_guide_table(guide, "PreparedCumulativeWeightedIndex");
         cumulative_.reserve(cumulative_boundaries.size());
         initialize(cumulative_boundaries.begin(), cumulative_boundaries.end());
+        search_.guide = detail::guide_index{cumulative_, total_, guide.cutpoints};
     }
 
     template<std::ranges::input_range Range>
         requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
-    explicit PreparedCumulativeWeightedIndex(Range&& cumulative_boundaries) {
+    explicit PreparedCumulativeWeightedIndex(Range&& cumulative_boundaries,
+                                             const guide_table guide) {
+        detail::validate_guide_table(guide, "PreparedCumulativeWeightedIndex");
         if constexpr (std::ranges::sized_range<Range>) {
             cumulative_.reserve(
                 static_cast<std::size_t>(std::ranges::size(cumulative_boundaries)));
         }
         initialize(std::ranges::begin(cumulative_boundaries),
                    std::ranges::end(cumulative_boundaries));
+        search_.guide = detail::guide_index{cumulative_, total_, guide.cutpoints};
     }
 
-    [[nodiscard]] auto operator()(engine_type& engine) const -> std::size_t {
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const -> std::size_t {
         return detail::select_prepared_weighted_index(
-            engine, cumulative_, total_, maximum_draw_);
+            engine, cumulative_, search_, total_, maximum_draw_);
+    }
+
+    template<random_engine Engine>
+    void select_many(Engine& engine, const std::span<std::size_t> output) const {
+        detail::select_prepared_weighted_indices(
+            engine, cumulative_, search_, total_, maximum_draw_, output);
+    }
+
+    template<random_engine Engine>
+    [[nodiscard]] auto sample_counts(Engine& engine, const std::uint64_t draws) const
+        -> std::vector<std::uint64_t> {
+        return detail::sample_cumulative_counts(engine, cumulative_, draws);
     }
 
 private:
@@ -248,71 +2023,835 @@ private:
             cumulative_.push_back(boundary);
             total_ = boundary;
         }
-        if (cumulative_.empty()) {
-            throw std::invalid_argument{
-                "PreparedCumulativeWeightedIndex requires at least one boundary"};
+        if (cumulative_.empty()) {
+            throw std::invalid_argument{
+                "PreparedCumulativeWeightedIndex requires at least one boundary"};
+        }
+        if (total_ == 0.0) {
+            throw std::invalid_argument{
+                "PreparedCumulativeWeightedIndex requires a positive final boundary"};
+        }
+        maximum_draw_ = std::nextafter(total_, 0.0);
+    }
+
+    void prepare_layout(const cumulative_layout layout) {
+        if (layout == cumulative_layout::eytzinger) {
+            search_.eytzinger = detail::eytzinger_index{cumulative_};
+        }
+    }
+
+    std::vector<double> cumulative_;
+    detail::prepared_search search_;
+    double total_{0.0};
+    double maximum_draw_{0.0};
+};
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto uniform_unsigned(Engine& engine,
+                             const std::uint64_t low,
+                             const std::uint64_t high,
+                             const Mapping mapping) -> std::uint64_t {
+    if (low > high) {
+        throw std::invalid_argument{"uniform_unsigned requires low <= high"};
+    }
+    const std::uint64_t span = high - low;
+    return low + detail::bounded(engine, span + std::uint64_t{1}, mapping);
+}
+
+template<random_engine Engine>
+inline auto uniform_unsigned(Engine& engine,
+                             const std::uint64_t low,
+                             const std::uint64_t high) -> std::uint64_t {
+    return uniform_unsigned(engine, low, high, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto uniform_unsigned(const std::uint64_t low,
+                             const std::uint64_t high,
+                             const Mapping mapping) -> std::uint64_t {
+    return uniform_unsigned(thread_engine(), low, high, mapping);
+}
+
+inline auto uniform_unsigned(const std::uint64_t low, const std::uint64_t high) -> std::uint64_t {
+    return uniform_unsigned(thread_engine(), low, high);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline void uniform_unsigned(Engine& engine,
+                             const std::uint64_t low,
+                             const std::uint64_t high,
+                             const std::span<std::uint64_t> output,
+                             const Mapping mapping) {
+    if (low > high) {
+        throw std::invalid_argument{"uniform_unsigned requires low <= high"};
+    }
+    const std::uint64_t span = high - low;
+    detail::bounded_fill(
+        engine, span + std::uint64_t{1}, output,
+        [low](const std::uint64_t offset) { return low + offset; }, mapping);
+}
+
+template<random_engine Engine>
+inline void uniform_unsigned(Engine& engine,
+                             const std::uint64_t low,
+                             const std::uint64_t high,
+                             const std::span<std::uint64_t> output) {
+    uniform_unsigned(engine, low, high, output, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline void uniform_unsigned(const std::uint64_t low,
+                             const std::uint64_t high,
+                             const std::span<std::uint64_t> output,
+                             const Mapping mapping) {
+    uniform_unsigned(thread_engine(), low, high, output, mapping);
+}
+
+inline void uniform_unsigned(const std::uint64_t low,
+                             const std::uint64_t high,
+                             const std::span<std::uint64_t> output) {
+    uniform_unsigned(thread_engine(), low, high, output);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto uniform_integer(Engine& engine,
+                            const std::int64_t low,
+                            const std::int64_t high,
+                            const Mapping mapping) -> std::int64_t {
+    if (low > high) {
+        throw std::invalid_argument{"uniform_integer requires low <= high"};
+    }
+    const std::uint64_t low_key = detail::signed_key(low);
+    const std::uint64_t span = detail::signed_key(high) - low_key;
+    return detail::signed_from_key(
+        low_key + detail::bounded(engine, span + std::uint64_t{1}, mapping));
+}
+
+template<random_engine Engine>
+inline auto uniform_integer(Engine& engine,
+                            const std::int64_t low,
+                            const std::int64_t high) -> std::int64_t {
+    return uniform_integer(engine, low, high, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto uniform_integer(const std::int64_t low,
+                            const std::int64_t high,
+                            const Mapping mapping) -> std::int64_t {
+    return uniform_integer(thread_engine(), low, high, mapping);
+}
+
+inline auto uniform_integer(const std::int64_t low, const std::int64_t high) -> std::int64_t {
+    return uniform_integer(thread_engine(), low, high);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline void uniform_integer(Engine& engine,
+                            const std::int64_t low,
+                            const std::int64_t high,
+                            const std::span<std::int64_t> output,
+                            const Mapping mapping) {
+    if (low > high) {
+        throw std::invalid_argument{"uniform_integer requires low <= high"};
+    }
+    const std::uint64_t low_key = detail::signed_key(low);
+    const std::uint64_t span = detail::signed_key(high) - low_key;
+    detail::bounded_fill(
+        engine, span + std::uint64_t{1}, output,
+        [low_key](const std::uint64_t offset) {
+            return detail::signed_from_key(low_key + offset);
+        },
+        mapping);
+}
+
+template<random_engine Engine>
+inline void uniform_integer(Engine& engine,
+                            const std::int64_t low,
+                            const std::int64_t high,
+                            const std::span<std::int64_t> output) {
+    uniform_integer(engine, low, high, output, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline void uniform_integer(const std::int64_t low,
+                            const std::int64_t high,
+                            const std::span<std::int64_t> output,
+                            const Mapping mapping) {
+    uniform_integer(thread_engine(), low, high, output, mapping);
+}
+
+inline void uniform_integer(const std::int64_t low,
+                            const std::int64_t high,
+                            const std::span<std::int64_t> output) {
+    uniform_integer(thread_engine(), low, high, output);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto uniform_index(Engine& engine, const std::size_t size, const Mapping mapping)
+    -> std::size_t {
+    if (size == 0) {
+        throw std::invalid_argument{"uniform_index requires a nonzero size"};
+    }
+    return static_cast<std::size_t>(
+        detail::bounded(engine, static_cast<std::uint64_t>(size), mapping));
+}
+
+template<random_engine Engine>
+inline auto uniform_index(Engine& engine, const std::size_t size) -> std::size_t {
+    return uniform_index(engine, size, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto uniform_index(const std::size_t size, const Mapping mapping) -> std::size_t {
+    return uniform_index(thread_engine(), size, mapping);
+}
+
+inline auto uniform_index(const std::size_t size) -> std::size_t {
+    return uniform_index(thread_engine(), size);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline void uniform_index(Engine& engine,
+                          const std::size_t size,
+                          const std::span<std::size_t> output,
+                          const Mapping mapping) {
+    if (size == 0) {
+        throw std::invalid_argument{"uniform_index requires a nonzero size"};
+    }
+    detail::bounded_fill(
+        engine, static_cast<std::uint64_t>(size), output,
+        [](const std::uint64_t offset) { return static_cast<std::size_t>(offset); }, mapping);
+}
+
+template<random_engine Engine>
+inline void uniform_index(Engine& engine,
+                          const std::size_t size,
+                          const std::span<std::size_t> output) {
+    uniform_index(engine, size, output, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline void uniform_index(const std::size_t size,
+                          const std::span<std::size_t> output,
+                          const Mapping mapping) {
+    uniform_index(thread_engine(), size, output, mapping);
+}
+
+inline void uniform_index(const std::size_t size, const std::span<std::size_t> output) {
+    uniform_index(thread_engine(), size, output);
+}
+
+namespace detail {
+
+inline constexpr std::size_t parallel_fill_block = std::size_t{1} << 16U;
+
+// Runs task(index) for each index below tasks on up to threads threads (0 = all cores).
+template<typename Task>
+void parallel_for(const std::size_t tasks, std::size_t threads, const Task& task) {
+    if (threads == 0) {
+        threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads = std::min(threads, tasks);
+    std::atomic<std::size_t> next_task{0};
+    const auto work = [&next_task, tasks, &task] {
+        for (std::size_t index = next_task.fetch_add(1, std::memory_order_relaxed);
+             index < tasks;
+             index = next_task.fetch_add(1, std::memory_order_relaxed)) {
+            task(index);
+        }
+    };
+    std::vector<std::jthread> workers;
+    workers.reserve(threads > 0 ? threads - 1 : 0);
+    for (std::size_t worker = 1; worker < threads; ++worker) {
+        workers.emplace_back(work);
+    }
+    work();
+}
+
+// Splits output into blocks of parallel_fill_block values and fills block b
+// from philox4x64{seed, b}, so the result depends only on the seed and each
+// value's position.
+template<typename Value, typename FillBlock>
+void parallel_fill(const std::uint64_t seed_value,
+                   const std::span<Value> output,
+                   const std::size_t threads,
+                   const FillBlock fill_block) {
+    const std::size_t blocks = (output.size() + parallel_fill_block - 1) / parallel_fill_block;
+    parallel_for(blocks, threads, [seed_value, output, &fill_block](const std::size_t block) {
+        philox4x64 engine{seed_value, block};
+        const std::size_t first = block * parallel_fill_block;
+        fill_block(engine,
+                   output.subspan(first, std::min(parallel_fill_block, output.size() - first)));
+    });
+}
+
+}  // namespace detail
+
+// Fills output with canonical values on up to threads threads, or
+// std::thread::hardware_concurrency() threads when threads is zero. The
+// values do not depend on the thread count.
+inline void parallel_fill_canonical(const std::uint64_t seed_value,
+                                    const std::span<double> output,
+                                    const std::size_t threads = 0) {
+    detail::parallel_fill(seed_value, output, threads,
+                          [](philox4x64& engine, const std::span<double> block) noexcept {
+                              for (double& value : block) {
+                                  value = detail::canonical_draw(engine);
+                              }
+                          });
+}
+
+inline void parallel_fill_index(const std::uint64_t seed_value,
+                                const std::size_t size,
+                                const std::span<std::size_t> output,
+                                const std::size_t threads = 0) {
+    if (size == 0) {
+        throw std::invalid_argument{"parallel_fill_index requires a nonzero size"};
+    }
+    detail::parallel_fill(seed_value, output, threads,
+                          [size](philox4x64& engine, const std::span<std::size_t> block) {
+                              uniform_index(engine, size, block);
+                          });
+}
+
+class PreparedUniformIndex {
+public:
+    explicit PreparedUniformIndex(const std::size_t size)
+        : bound_{validated_bound(size)},
+          threshold_{detail::bounded_threshold(bound_)},
+          remainder_{bound_} {}
+
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const noexcept -> std::size_t {
+        for (;;) {
+            const auto value = static_cast<std::uint64_t>(engine());
+            if (value >= threshold_) {
+                return static_cast<std::size_t>(remainder_(value));
+            }
+        }
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(bound_);
+    }
+
+private:
+    static auto validated_bound(const std::size_t size) -> std::uint64_t {
+        if (size == 0) {
+            throw std::invalid_argument{"PreparedUniformIndex requires a nonzero size"};
+        }
+        return static_cast<std::uint64_t>(size);
+    }
+
+    std::uint64_t bound_;
+    std::uint64_t threshold_;
+    detail::fixed_remainder remainder_;
+};
+
+class PreparedAliasWeightedIndex {
+public:
+    explicit PreparedAliasWeightedIndex(const std::initializer_list<double> weights)
+        : PreparedAliasWeightedIndex{validated_weights(weights.begin(), weights.end(),
+                                                       weights.size())} {}
+
+    template<std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
+    explicit PreparedAliasWeightedIndex(Range&& weights)
+        : PreparedAliasWeightedIndex{validated_weights(
+              std::ranges::begin(weights), std::ranges::end(weights), reserve_hint(weights))} {}
+
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const noexcept -> std::size_t {
+        const std::size_t column = column_(engine);
+        const detail::alias_entry& entry = table_[column];
+        return static_cast<std::uint64_t>(engine()) < entry.threshold ? column : entry.alias;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return table_.size(); }
+
+private:
+    struct validated_table {
+        std::vector<double> weights;
+        double total;
+    };
+
+    explicit PreparedAliasWeightedIndex(const validated_table& validated)
+        : table_{detail::make_alias_table(validated.weights, validated.total)},
+          column_{validated.weights.size()} {}
+
+    template<std::ranges::input_range Range>
+    static auto reserve_hint(Range& weights) -> std::size_t {
+        if constexpr (std::ranges::sized_range<Range>) {
+            return static_cast<std::size_t>(std::ranges::size(weights));
+        } else {
+            return 0;
+        }
+    }
+
+    template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        requires std::convertible_to<std::iter_reference_t<Iterator>, double>
+    static auto validated_weights(Iterator first, const Sentinel last, const std::size_t hint)
+        -> validated_table {
+        validated_table validated{{}, 0.0};
+        validated.weights.reserve(hint);
+        for (; first != last; ++first) {
+            const auto weight = static_cast<double>(*first);
+            validated.total = detail::add_validated_weight(
+                validated.total, weight, "PreparedAliasWeightedIndex");
+            validated.weights.push_back(weight);
+        }
+        detail::validate_weight_total(
+            validated.weights.size(), validated.total, "PreparedAliasWeightedIndex");
+        return validated;
+    }
+
+    std::vector<detail::alias_entry> table_;
+    PreparedUniformIndex column_;
+};
+
+class DynamicWeightedIndex {
+public:
+    explicit DynamicWeightedIndex(const std::initializer_list<double> weights) {
+        initialize(weights.begin(), weights.end());
+    }
+
+    template<std::ranges::input_range Range>
+        requires std::convertible_to<std::ranges::range_reference_t<Range>, double>
+    explicit DynamicWeightedIndex(Range&& weights) {
+        initialize(std::ranges::begin(weights), std::ranges::end(weights));
+    }
+
+    // Descends the sum tree with one canonical draw scaled by the total. A
+    // child whose subtree sums to zero is never entered, so rounding cannot
+    // select a zero-weight entry.
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const noexcept -> std::size_t {
+        double remaining = canonical(engine) * tree_[1];
+        std::size_t node = 1;
+        while (node < capacity_) {
+            const double left = tree_[2 * node];
+            const double right = tree_[(2 * node) + 1];
+            if (remaining < left || right == 0.0) {
+                node = 2 * node;
+            } else {
+                remaining -= left;
+                node = (2 * node) + 1;
+            }
+        }
+        return node - capacity_;
+    }
+
+    // Applies the prepared selectors' overflow rule as if weight were added
+    // last to the other entries' total.
+    void set_weight(const std::size_t index, const double weight) {
+        check_index(index);
+        validate_weight(weight);
+        const double previous = tree_[capacity_ + index];
+        check_total(tree_[1] - previous, weight);
+        assign(index, weight);
+        if (!std::isfinite(tree_[1]) || tree_[1] == 0.0) {
+            const bool overflowed = !std::isfinite(tree_[1]);
+            assign(index, previous);
+            throw_invalid_total(overflowed);
+        }
+    }
+
+    // Appends an entry and returns its index. Capacity doubles when full, so
+    // the cost is O(log n) amortized.
+    auto add(const double weight) -> std::size_t {
+        validate_weight(weight);
+        check_total(tree_[1], weight);
+        if (size_ == capacity_) {
+            grow();
+        }
+        const std::size_t index = size_;
+        ++size_;
+        assign(index, weight);
+        if (!std::isfinite(tree_[1])) {
+            assign(index, 0.0);
+            --size_;
+            throw_invalid_total(true);
+        }
+        return index;
+    }
+
+    // Removes entry index by moving the last entry into its place, so only the
+    // former last index changes.
+    void remove(const std::size_t index) {
+        check_index(index);
+        if (size_ == 1) {
+            throw std::invalid_argument{std::string{owner} + " requires at least one weight"};
+        }
+        const std::size_t last = size_ - 1;
+        const double removed = tree_[capacity_ + index];
+        const double moved = tree_[capacity_ + last];
+        assign(last, 0.0);
+        if (index != last) {
+            assign(index, moved);
+        }
+        --size_;
+        if (tree_[1] == 0.0) {
+            ++size_;
+            assign(index, removed);
+            assign(last, moved);
+            throw_invalid_total(false);
+        }
+    }
+
+    [[nodiscard]] auto weight(const std::size_t index) const -> double {
+        check_index(index);
+        return tree_[capacity_ + index];
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t { return size_; }
+    [[nodiscard]] auto total() const noexcept -> double { return tree_[1]; }
+
+private:
+    static constexpr std::string_view owner = "DynamicWeightedIndex";
+
+    template<std::input_iterator Iterator, std::sentinel_for<Iterator> Sentinel>
+        requires std::convertible_to<std::iter_reference_t<Iterator>, double>
+    void initialize(Iterator first, const Sentinel last) {
+        std::vector<double> weights;
+        double total = 0.0;
+        for (; first != last; ++first) {
+            const auto value = static_cast<double>(*first);
+            total = detail::add_validated_weight(total, value, owner);
+            weights.push_back(value);
+        }
+        detail::validate_weight_total(weights.size(), total, owner);
+        size_ = weights.size();
+        rebuild(std::bit_ceil(size_), weights);
+        if (!std::isfinite(tree_[1])) {
+            throw_invalid_total(true);
+        }
+    }
+
+    void rebuild(const std::size_t capacity, const std::span<const double> weights) {
+        std::vector<double> tree(2 * capacity, 0.0);
+        std::ranges::copy(weights, tree.begin() + static_cast<std::ptrdiff_t>(capacity));
+        for (std::size_t node = capacity - 1; node > 0; --node) {
+            tree[node] = tree[2 * node] + tree[(2 * node) + 1];
+        }
+        tree_ = std::move(tree);
+        capacity_ = capacity;
+    }
+
+    void grow() {
+        const std::vector<double> weights(
+            tree_.begin() + static_cast<std::ptrdiff_t>(capacity_),
+            tree_.begin() + static_cast<std::ptrdiff_t>(capacity_ + size_));
+        rebuild(2 * capacity_, weights);
+    }
+
+    // Recomputes every ancestor from its children rather than applying a
+    // difference, so sums never drift from the stored weights.
+    void assign(const std::size_t index, const double weight) noexcept {
+        std::size_t node = capacity_ + index;
+        tree_[node] = weight;
+        for (node /= 2; node > 0; node /= 2) {
+            tree_[node] = tree_[2 * node] + tree_[(2 * node) + 1];
+        }
+    }
+
+    void check_index(const std::size_t index) const {
+        if (index >= size_) {
+            throw std::out_of_range{std::string{owner} + " index is out of range"};
+        }
+    }
+
+    static void validate_weight(const double weight) {
+        if (!std::isfinite(weight) || weight < 0.0) {
+            throw std::invalid_argument{std::string{owner} +
+                                        " requires finite, nonnegative weights"};
+        }
+    }
+
+    static void check_total(const double others, const double weight) {
+        if (weight > std::numeric_limits<double>::max() - others) {
+            throw_invalid_total(true);
+        }
+    }
+
+    [[noreturn]] static void throw_invalid_total(const bool overflowed) {
+        if (overflowed) {
+            throw std::overflow_error{std::string{owner} + " total weight is not representable"};
+        }
+        throw std::invalid_argument{std::string{owner} + " requires at least one positive weight"};
+    }
+
+    std::vector<double> tree_;
+    std::size_t capacity_ = 0;
+    std::size_t size_ = 0;
+};
+
+namespace detail {
+
+inline constexpr std::size_t wide_permutation_batch = 32;
+
+// Fortuna 6.0.2's native Knuth-B construction shared by both wide selectors.
+// The schedule does not depend on the index type. Each batch draws the swap
+// targets for the next positions and prefetches them before swapping; the
+// draws do not depend on the permutation, so the engine schedule and result
+// match one uniform_unsigned(engine, position, size - 1) per position.
+template<std::unsigned_integral Index, random_engine Engine>
+auto make_wide_permutation(Engine& engine, const std::size_t size) -> std::vector<Index> {
+    std::vector<Index> permutation(size);
+    std::iota(permutation.begin(), permutation.end(), Index{0});
+    const std::size_t last = size - 1;
+    std::array<std::size_t, wide_permutation_batch> others{};
+    std::size_t position = last;
+    while (position > 0) {
+        const std::size_t count = std::min(position, wide_permutation_batch);
+        for (std::size_t step = 0; step < count; ++step) {
+            const std::size_t current = position - 1 - step;
+            others[step] = current + static_cast<std::size_t>(
+                                         bounded_deferred(engine, last - current + 1));
+            prefetch(permutation.data() + others[step]);
+        }
+        for (std::size_t step = 0; step < count; ++step) {
+            std::swap(permutation[position - 1 - step], permutation[others[step]]);
+        }
+        position -= count;
+    }
+    return permutation;
+}
+
+// A wide selector's permutation of [0, size), stored in the narrowest of 16,
+// 32, or 64 bits that holds size - 1. The first insert or remove builds the
+// inverse map from index to position, which both then keep current.
+class wide_permutation {
+public:
+    template<random_engine Engine>
+    wide_permutation(Engine& engine, const std::size_t size, const std::string_view owner)
+        : tables_{make_table(engine, size, owner)} {}
+
+    // Calls visitor with the underlying index vector, so a loop over many
+    // positions dispatches on the storage type once.
+    template<typename Visitor>
+    decltype(auto) visit(Visitor&& visitor) const {
+        return std::visit(
+            [&visitor](const auto& current) -> decltype(auto) {
+                return std::forward<Visitor>(visitor)(current.indices);
+            },
+            tables_);
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return visit([](const auto& indices) { return indices.size(); });
+    }
+
+    [[nodiscard]] auto index_size() const noexcept -> std::size_t {
+        return visit([](const auto& indices) {
+            return sizeof(typename std::decay_t<decltype(indices)>::value_type);
+        });
+    }
+
+    [[nodiscard]] auto operator[](const std::size_t position) const noexcept -> std::size_t {
+        return visit([position](const auto& indices) {
+            return static_cast<std::size_t>(indices[position]);
+        });
+    }
+
+    // Adds index size() at a uniformly drawn position in [0, size()], moving
+    // the entry there to the end: one inside-out Fisher-Yates step, so a
+    // uniformly shuffled permutation stays uniformly shuffled. Storage grows
+    // before the draw, so an allocation failure consumes no engine values.
+    // Returns the drawn position.
+    template<random_engine Engine>
+    auto insert(Engine& engine) -> std::size_t {
+        const std::size_t index = size();
+        build_positions();
+        if (index > largest_index()) {
+            widen();
+        }
+        std::visit(
+            [](auto& current) {
+                reserve_next(current.indices);
+                reserve_next(current.positions);
+            },
+            tables_);
+        const auto position = static_cast<std::size_t>(bounded(engine, index + 1));
+        std::visit(
+            [index, position](auto& current) {
+                using Index = typename std::decay_t<decltype(current.indices)>::value_type;
+                current.indices.push_back(static_cast<Index>(index));
+                current.positions.push_back(static_cast<Index>(index));
+                if (position != index) {
+                    const Index moved = current.indices[position];
+                    current.indices[index] = moved;
+                    current.positions[moved] = static_cast<Index>(index);
+                    current.indices[position] = static_cast<Index>(index);
+                    current.positions[index] = static_cast<Index>(position);
+                }
+            },
+            tables_);
+        return position;
+    }
+
+    // Removes index by moving the last position's entry into its position,
+    // then renames index size() - 1 to index. Returns the vacated position.
+    auto remove(const std::size_t index) -> std::size_t {
+        build_positions();
+        return std::visit(
+            [index](auto& current) {
+                using Index = typename std::decay_t<decltype(current.indices)>::value_type;
+                const std::size_t last = current.indices.size() - 1;
+                const std::size_t position = current.positions[index];
+                const Index moved = current.indices[last];
+                current.indices[position] = moved;
+                current.positions[moved] = static_cast<Index>(position);
+                current.indices.pop_back();
+                if (index != last) {
+                    const std::size_t renamed = current.positions[last];
+                    current.indices[renamed] = static_cast<Index>(index);
+                    current.positions[index] = static_cast<Index>(renamed);
+                }
+                current.positions.pop_back();
+                return position;
+            },
+            tables_);
+    }
+
+private:
+    template<std::unsigned_integral Index>
+    struct table {
+        std::vector<Index> indices;
+        std::vector<Index> positions;
+    };
+
+    using storage =
+        std::variant<table<std::uint16_t>, table<std::uint32_t>, table<std::size_t>>;
+
+    template<random_engine Engine>
+    static auto make_table(Engine& engine, const std::size_t size, const std::string_view owner)
+        -> storage {
+        if (size == 0) {
+            throw std::invalid_argument{std::string{owner} + " requires a nonzero size"};
+        }
+        if (size - 1 <= std::numeric_limits<std::uint16_t>::max()) {
+            return table<std::uint16_t>{make_wide_permutation<std::uint16_t>(engine, size), {}};
         }
-        if (total_ == 0.0) {
-            throw std::invalid_argument{
-                "PreparedCumulativeWeightedIndex requires a positive final boundary"};
+        if (size - 1 <= std::numeric_limits<std::uint32_t>::max()) {
+            return table<std::uint32_t>{make_wide_permutation<std::uint32_t>(engine, size), {}};
         }
-        maximum_draw_ = std::nextafter(total_, 0.0);
+        return table<std::size_t>{make_wide_permutation<std::size_t>(engine, size), {}};
     }
 
-    std::vector<double> cumulative_;
-    double total_{0.0};
-    double maximum_draw_{0.0};
-};
+    void build_positions() {
+        std::visit(
+            [](auto& current) {
+                using Index = typename std::decay_t<decltype(current.indices)>::value_type;
+                if (!current.positions.empty()) {
+                    return;
+                }
+                current.positions.resize(current.indices.size());
+                for (std::size_t position = 0; position < current.indices.size(); ++position) {
+                    current.positions[current.indices[position]] = static_cast<Index>(position);
+                }
+            },
+            tables_);
+    }
 
-inline auto uniform_unsigned(engine_type& engine,
-                             const std::uint64_t low,
-                             const std::uint64_t high) -> std::uint64_t {
-    if (low > high) {
-        throw std::invalid_argument{"uniform_unsigned requires low <= high"};
+    [[nodiscard]] auto largest_index() const noexcept -> std::size_t {
+        return visit([](const auto& indices) {
+            using Index = typename std::decay_t<decltype(indices)>::value_type;
+            return static_cast<std::size_t>(std::numeric_limits<Index>::max());
+        });
     }
-    const std::uint64_t span = high - low;
-    return low + detail::bounded(engine, span + std::uint64_t{1});
-}
 
-inline auto uniform_unsigned(const std::uint64_t low, const std::uint64_t high) -> std::uint64_t {
-    return uniform_unsigned(thread_engine(), low, high);
-}
+    // Doubles a full vector's capacity, so the next push_back cannot throw.
+    template<typename Vector>
+    static void reserve_next(Vector& vector) {
+        if (vector.size() == vector.capacity()) {
+            vector.reserve(std::max<std::size_t>(1, vector.size() * 2));
+        }
+    }
 
-inline auto uniform_integer(engine_type& engine,
-                            const std::int64_t low,
-                            const std::int64_t high) -> std::int64_t {
-    if (low > high) {
-        throw std::invalid_argument{"uniform_integer requires low <= high"};
+    // Moves both vectors to the next wider index type.
+    void widen() {
+        if (auto* const narrow = std::get_if<table<std::uint16_t>>(&tables_)) {
+            tables_ = widened<std::uint32_t>(*narrow);
+        } else if (auto* const middle = std::get_if<table<std::uint32_t>>(&tables_)) {
+            tables_ = widened<std::size_t>(*middle);
+        }
     }
-    const std::uint64_t low_key = detail::signed_key(low);
-    const std::uint64_t span = detail::signed_key(high) - low_key;
-    return detail::signed_from_key(low_key + detail::bounded(engine, span + std::uint64_t{1}));
-}
 
-inline auto uniform_integer(const std::int64_t low, const std::int64_t high) -> std::int64_t {
-    return uniform_integer(thread_engine(), low, high);
-}
+    template<std::unsigned_integral Wider, std::unsigned_integral Index>
+    static auto widened(const table<Index>& current) -> table<Wider> {
+        return {{current.indices.begin(), current.indices.end()},
+                {current.positions.begin(), current.positions.end()}};
+    }
 
-inline auto uniform_index(engine_type& engine, const std::size_t size) -> std::size_t {
-    if (size == 0) {
-        throw std::invalid_argument{"uniform_index requires a nonzero size"};
+    storage tables_;
+};
+
+// Alias table for Poisson(width / 4) conditioned on [0, width).
+class truncated_poisson_table {
+public:
+    explicit truncated_poisson_table(const std::size_t width)
+        : truncated_poisson_table{tabulate(width)} {}
+
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) const noexcept -> std::size_t {
+        return first_ + alias_(engine);
     }
-    return static_cast<std::size_t>(detail::bounded(engine, static_cast<std::uint64_t>(size)));
-}
 
-inline auto uniform_index(const std::size_t size) -> std::size_t {
-    return uniform_index(thread_engine(), size);
-}
+private:
+    struct tabulation {
+        std::size_t first;
+        std::vector<double> weights;
+    };
+
+    explicit truncated_poisson_table(const tabulation& table)
+        : first_{table.first}, alias_{table.weights} {}
+
+    // Walks outward from the mode with the ratios p(k + 1) / p(k) = mean / (k + 1).
+    static auto tabulate(const std::size_t width) -> tabulation {
+        constexpr double negligible = 0x1.0p-64;
+        const double mean = static_cast<double>(width) / 4.0;
+        const std::size_t mode = std::min(static_cast<std::size_t>(mean), width - 1);
+
+        std::vector<double> below;
+        double weight = 1.0;
+        for (std::size_t value = mode; value > 0 && weight >= negligible; --value) {
+            weight *= static_cast<double>(value) / mean;
+            below.push_back(weight);
+        }
+        while (!below.empty() && below.back() < negligible) {
+            below.pop_back();
+        }
+
+        tabulation table{mode - below.size(), {below.rbegin(), below.rend()}};
+        table.weights.push_back(1.0);
+        weight = 1.0;
+        for (std::size_t value = mode + 1; value < width; ++value) {
+            weight *= mean / static_cast<double>(value);
+            if (weight < negligible) {
+                break;
+            }
+            table.weights.push_back(weight);
+        }
+        return table;
+    }
+
+    std::size_t first_;
+    PreparedAliasWeightedIndex alias_;
+};
+
+}  // namespace detail
 
 class wide_index_selector {
 public:
-    explicit wide_index_selector(engine_type& engine, const std::size_t size)
-        : permutation_{make_permutation(engine, size)},
+    template<random_engine Engine>
+    explicit wide_index_selector(Engine& engine, const std::size_t size)
+        : permutation_{engine, size, "wide_index_selector"},
           cursor_{permutation_.size() - 1},
           rotation_width_{detail::integer_sqrt(size)},
           distance_{static_cast<double>(rotation_width_) / 4.0} {}
 
-    [[nodiscard]] auto operator()(engine_type& engine) -> std::size_t {
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) -> std::size_t {
         distance_type sample = 0;
         do {
             sample = distance_(engine);
@@ -323,62 +2862,608 @@ public:
         return permutation_[cursor_];
     }
 
+    // Writes the indices output.size() repeated calls would return, consuming
+    // the same engine values. The storage type is dispatched once, and since a
+    // step never exceeds the size, the cursor moves without a modulo.
+    template<random_engine Engine>
+    void select_many(Engine& engine, const std::span<std::size_t> output) {
+        const auto width = static_cast<distance_type>(rotation_width_);
+        const std::size_t size = permutation_.size();
+        std::size_t cursor = cursor_;
+        permutation_.visit([&](const auto& indices) {
+            for (std::size_t& selected : output) {
+                distance_type sample = 0;
+                do {
+                    sample = distance_(engine);
+                } while (sample >= width);
+
+                const std::size_t step = static_cast<std::size_t>(sample) + 1;
+                cursor = cursor >= step ? cursor - step : cursor + (size - step);
+                selected = static_cast<std::size_t>(indices[cursor]);
+            }
+        });
+        cursor_ = cursor;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t {
+        return permutation_.size();
+    }
+
+    // Adds index size() at a uniformly drawn permutation position and returns
+    // it. The first insert or remove builds an index-to-position map; later
+    // ones are O(1) amortized. The cursor stays on the most recent selection.
+    template<random_engine Engine>
+    auto insert(Engine& engine) -> std::size_t {
+        const std::size_t index = permutation_.size();
+        if (permutation_.insert(engine) == cursor_) {
+            cursor_ = index;
+        }
+        update_rotation_width();
+        return index;
+    }
+
+    // Removes index by moving the last permutation position into its place,
+    // and renames index size() - 1 to index, so only that index changes.
+    void remove(const std::size_t index) {
+        const std::size_t last = permutation_.size() - 1;
+        if (index > last) {
+            throw std::out_of_range{"wide_index_selector index is out of range"};
+        }
+        if (last == 0) {
+            throw std::invalid_argument{"wide_index_selector requires at least one index"};
+        }
+        const std::size_t position = permutation_.remove(index);
+        if (cursor_ == last) {
+            cursor_ = position == last ? 0 : position;
+        }
+        update_rotation_width();
+    }
+
 private:
     using distance_type = std::uint64_t;
 
-    static auto make_permutation(engine_type& engine, const std::size_t size)
-        -> std::vector<std::size_t> {
-        if (size == 0) {
-            throw std::invalid_argument{"wide_index_selector requires a nonzero size"};
+    // A size change moves integer_sqrt(size) by at most one.
+    void update_rotation_width() {
+        const std::size_t size = permutation_.size();
+        std::size_t width = rotation_width_;
+        if (width + 1 <= size / (width + 1)) {
+            ++width;
+        } else if (width > size / width) {
+            --width;
         }
-
-        std::vector<std::size_t> permutation(size);
-        std::iota(permutation.begin(), permutation.end(), std::size_t{0});
-        const std::size_t last = size - 1;
-        std::size_t position = last;
-        while (position > 0) {
-            --position;
-            const auto other = static_cast<std::size_t>(Storm::uniform_unsigned(
-                engine,
-                static_cast<std::uint64_t>(position),
-                static_cast<std::uint64_t>(last)));
-            std::swap(permutation[position], permutation[other]);
+        if (width != rotation_width_) {
+            rotation_width_ = width;
+            distance_ = std::poisson_distribution<distance_type>{static_cast<double>(width) / 4.0};
         }
-        return permutation;
     }
 
-    std::vector<std::size_t> permutation_;
+    detail::wide_permutation permutation_;
     std::size_t cursor_ = 0;
     std::size_t rotation_width_;
     std::poisson_distribution<distance_type> distance_;
 };
 
-inline auto random_range(engine_type& engine,
-                         const std::int64_t start,
-                         const std::int64_t stop,
-                         const std::int64_t step) -> std::int64_t {
-    if (step == 0) {
-        throw std::invalid_argument{"random_range step must not be zero"};
+// wide_index_selector's permutation and backward cursor walk, with the
+// truncated Poisson distance drawn from a table prepared at construction:
+// each selection makes one alias draw, never rejects, and depends only on
+// Storm-owned algorithms.
+class alias_wide_index_selector {
+public:
+    template<random_engine Engine>
+    explicit alias_wide_index_selector(Engine& engine, const std::size_t size)
+        : permutation_{engine, size, "alias_wide_index_selector"},
+          cursor_{permutation_.size() - 1},
+          distance_{detail::integer_sqrt(size)} {}
+
+    template<random_engine Engine>
+    [[nodiscard]] auto operator()(Engine& engine) noexcept -> std::size_t {
+        cursor_ = detail::subtract_modulo(cursor_, distance_(engine) + 1, permutation_.size());
+        return permutation_[cursor_];
     }
-    const std::uint64_t start_key = detail::signed_key(start);
-    if (step > 0) {
-        if (start >= stop) {
-            throw std::invalid_argument{"random_range is empty for this positive step"};
+
+private:
+    detail::wide_permutation permutation_;
+    std::size_t cursor_ = 0;
+    detail::truncated_poisson_table distance_;
+};
+
+// Feistel bijection on the smallest even bit width covering size - 1, cycle-walked
+// into [0, size). operator[] is unchecked and may not return past size; at() checks.
+class lazy_permutation {
+public:
+    static constexpr std::size_t rounds = 6;
+
+    class iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = std::uint64_t;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() noexcept = default;
+
+        [[nodiscard]] auto operator*() const noexcept -> std::uint64_t {
+            return (*permutation_)[position_];
+        }
+
+        auto operator++() noexcept -> iterator& {
+            ++position_;
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> iterator {
+            iterator previous = *this;
+            ++position_;
+            return previous;
+        }
+
+        friend auto operator==(const iterator& left, const iterator& right) noexcept -> bool {
+            return left.position_ == right.position_;
+        }
+
+    private:
+        friend class lazy_permutation;
+
+        iterator(const lazy_permutation& permutation, const std::uint64_t position) noexcept
+            : permutation_{&permutation}, position_{position} {}
+
+        const lazy_permutation* permutation_ = nullptr;
+        std::uint64_t position_ = 0;
+    };
+
+    // Draws one raw engine value per round key.
+    template<random_engine Engine>
+    explicit lazy_permutation(Engine& engine, const std::uint64_t size)
+        : size_{validated_size(size)},
+          half_bits_{(std::max(static_cast<int>(std::bit_width(size - 1)), 2) + 1) / 2},
+          half_mask_{(std::uint64_t{1} << static_cast<unsigned>(half_bits_)) - 1} {
+        for (std::uint64_t& key : keys_) {
+            key = static_cast<std::uint64_t>(engine());
         }
-        const auto stride = static_cast<std::uint64_t>(step);
-        const std::uint64_t span = detail::signed_key(stop) - start_key;
-        const std::uint64_t count = ((span - std::uint64_t{1}) / stride) + std::uint64_t{1};
-        const std::uint64_t offset = detail::bounded(engine, count);
-        return detail::signed_from_key(start_key + offset * stride);
     }
-    if (start <= stop) {
-        throw std::invalid_argument{"random_range is empty for this negative step"};
+
+    [[nodiscard]] auto size() const noexcept -> std::uint64_t {
+        return size_;
     }
-    const std::uint64_t stride = std::uint64_t{0} - static_cast<std::uint64_t>(step);
-    const std::uint64_t span = start_key - detail::signed_key(stop);
-    const std::uint64_t count = ((span - std::uint64_t{1}) / stride) + std::uint64_t{1};
-    const std::uint64_t offset = detail::bounded(engine, count);
-    return detail::signed_from_key(start_key - offset * stride);
+
+    [[nodiscard]] auto operator[](const std::uint64_t position) const noexcept -> std::uint64_t {
+        std::uint64_t value = position;
+        do {
+            value = encrypt(value);
+        } while (value >= size_);
+        return value;
+    }
+
+    [[nodiscard]] auto at(const std::uint64_t position) const -> std::uint64_t {
+        if (position >= size_) {
+            throw std::out_of_range{"lazy_permutation position is out of range"};
+        }
+        return (*this)[position];
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> iterator {
+        return {*this, 0};
+    }
+
+    [[nodiscard]] auto end() const noexcept -> iterator {
+        return {*this, size_};
+    }
+
+private:
+    static auto validated_size(const std::uint64_t size) -> std::uint64_t {
+        if (size == 0) {
+            throw std::invalid_argument{"lazy_permutation requires a nonzero size"};
+        }
+        return size;
+    }
+
+    [[nodiscard]] auto encrypt(const std::uint64_t value) const noexcept -> std::uint64_t {
+        const auto shift = static_cast<unsigned>(half_bits_);
+        std::uint64_t left = value >> shift;
+        std::uint64_t right = value & half_mask_;
+        for (const std::uint64_t key : keys_) {
+            std::uint64_t state = right ^ key;
+            const std::uint64_t mixed = left ^ (detail::splitmix64(state) & half_mask_);
+            left = right;
+            right = mixed;
+        }
+        return (left << shift) | right;
+    }
+
+    std::uint64_t size_;
+    int half_bits_;
+    std::uint64_t half_mask_;
+    std::array<std::uint64_t, rounds> keys_{};
+};
+
+namespace detail {
+
+// The largest remaining length at which one engine value yields count
+// positions: each bound is at most 2^{30, 19, 14, 11, 9}, so their product
+// stays at or below 2^60 and a whole-batch rejection is rare.
+inline constexpr std::array<std::uint64_t, 5> shuffle_batch_limits{
+    std::uint64_t{1} << 30U,
+    std::uint64_t{1} << 19U,
+    std::uint64_t{1} << 14U,
+    std::uint64_t{1} << 11U,
+    std::uint64_t{1} << 9U,
+};
+
+// How many swap targets a shuffle draws before performing their swaps.
+inline constexpr std::size_t shuffle_lookahead = 32;
+
+inline constexpr auto shuffle_batch_size(const std::uint64_t length) noexcept -> std::size_t {
+    std::size_t count = 1;
+    for (const std::uint64_t limit : shuffle_batch_limits) {
+        if (length > limit) {
+            break;
+        }
+        ++count;
+    }
+    return count;
+}
+
+}  // namespace detail
+
+// Durstenfeld's Fisher-Yates shuffle. For position from size - 1 down to 1,
+// swaps the element there with the one at bounded(engine, position + 1). The
+// targets for the next positions are drawn ahead of their swaps, and
+// prefetched for a contiguous range; the draws do not depend on the elements,
+// so this keeps the schedule.
+template<std::ranges::random_access_range Range, bounded_mapping Mapping, random_engine Engine>
+    requires std::ranges::sized_range<Range> &&
+             std::permutable<std::ranges::iterator_t<Range>>
+inline void shuffle(Engine& engine, Range&& range, const Mapping mapping) {
+    using difference = std::ranges::range_difference_t<Range>;
+    constexpr std::size_t batch_limit = detail::shuffle_batch_limits.size() + 1;
+    const auto first = std::ranges::begin(range);
+    auto position = static_cast<std::uint64_t>(std::ranges::size(range));
+    std::array<std::uint64_t, detail::shuffle_lookahead + batch_limit> others{};
+    while (position > 1) {
+        std::size_t drawn = 0;
+        for (std::uint64_t length = position; drawn < detail::shuffle_lookahead && length > 1;) {
+            std::size_t count = 1;
+            if constexpr (std::same_as<Mapping, modulo_mapping_t>) {
+                others[drawn] = detail::bounded_deferred(engine, length);
+            } else {
+                // Several positions per engine value while the length is small.
+                count = std::min<std::size_t>(detail::shuffle_batch_size(length),
+                                              static_cast<std::size_t>(length - 1));
+                if (count == 1) {
+                    others[drawn] = detail::bounded(engine, length, mapping);
+                } else {
+                    std::uint64_t product = 1;
+                    for (std::size_t offset = 0; offset < count; ++offset) {
+                        product *= length - offset;
+                    }
+                    detail::bounded_descending_batch(
+                        engine, length, product, std::span{others}.subspan(drawn, count));
+                }
+            }
+            drawn += count;
+            length -= count;
+        }
+        if constexpr (std::ranges::contiguous_range<Range>) {
+            for (std::size_t index = 0; index < drawn; ++index) {
+                detail::prefetch(std::to_address(first + static_cast<difference>(others[index])));
+            }
+        }
+        for (std::size_t index = 0; index < drawn; ++index) {
+            --position;
+            std::ranges::iter_swap(first + static_cast<difference>(position),
+                                   first + static_cast<difference>(others[index]));
+        }
+    }
+}
+
+template<std::ranges::random_access_range Range, random_engine Engine>
+    requires std::ranges::sized_range<Range> &&
+             std::permutable<std::ranges::iterator_t<Range>>
+inline void shuffle(Engine& engine, Range&& range) {
+    shuffle(engine, std::forward<Range>(range), modulo_mapping);
+}
+
+template<std::ranges::random_access_range Range, bounded_mapping Mapping>
+    requires std::ranges::sized_range<Range> &&
+             std::permutable<std::ranges::iterator_t<Range>>
+inline void shuffle(Range&& range, const Mapping mapping) {
+    shuffle(thread_engine(), std::forward<Range>(range), mapping);
+}
+
+template<std::ranges::random_access_range Range>
+    requires std::ranges::sized_range<Range> &&
+             std::permutable<std::ranges::iterator_t<Range>>
+inline void shuffle(Range&& range) {
+    shuffle(thread_engine(), std::forward<Range>(range));
+}
+
+namespace detail {
+
+inline constexpr std::size_t parallel_shuffle_block = std::size_t{1} << 20U;
+inline constexpr std::size_t parallel_shuffle_bucket = std::size_t{1} << 18U;
+inline constexpr std::uint64_t parallel_shuffle_bucket_stream = std::uint64_t{1} << 63U;
+
+// Scatters to uniform buckets, then shuffles each; see docs/API-CONTRACTS.md.
+template<typename Value>
+void parallel_shuffle(const std::uint64_t seed_value,
+                      const std::span<Value> values,
+                      const std::size_t threads,
+                      const std::size_t block_size,
+                      const std::size_t bucket_size) {
+    const std::size_t size = values.size();
+    const std::size_t buckets = std::max<std::size_t>(1, (size + bucket_size - 1) / bucket_size);
+    if (buckets == 1) {
+        philox4x64 engine{seed_value, parallel_shuffle_bucket_stream};
+        Storm::shuffle(engine, values, nearly_divisionless_mapping);
+        return;
+    }
+    const std::size_t blocks = (size + block_size - 1) / block_size;
+    const auto bucket_index = [buckets](philox4x64& engine) noexcept {
+        return static_cast<std::size_t>(bounded(engine, buckets, nearly_divisionless_mapping));
+    };
+    const auto block_values = [values, block_size](const std::size_t block) {
+        const std::size_t first = block * block_size;
+        return values.subspan(first, std::min(block_size, values.size() - first));
+    };
+
+    // offsets[block * buckets + bucket] first counts, then locates, the
+    // values block sends to bucket.
+    std::vector<std::size_t> offsets(blocks * buckets);
+    parallel_for(blocks, threads, [&](const std::size_t block) {
+        philox4x64 engine{seed_value, block};
+        const std::span<std::size_t> counts{offsets.data() + (block * buckets), buckets};
+        for (std::size_t remaining = block_values(block).size(); remaining > 0; --remaining) {
+            ++counts[bucket_index(engine)];
+        }
+    });
+    std::vector<std::size_t> bucket_starts(buckets + 1);
+    std::size_t offset = 0;
+    for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+        bucket_starts[bucket] = offset;
+        for (std::size_t block = 0; block < blocks; ++block) {
+            const std::size_t count = offsets[(block * buckets) + bucket];
+            offsets[(block * buckets) + bucket] = offset;
+            offset += count;
+        }
+    }
+    bucket_starts[buckets] = offset;
+
+    auto scratch = std::make_unique_for_overwrite<Value[]>(size);
+    parallel_for(blocks, threads, [&](const std::size_t block) {
+        philox4x64 engine{seed_value, block};
+        const std::span<std::size_t> next{offsets.data() + (block * buckets), buckets};
+        for (Value& value : block_values(block)) {
+            scratch[next[bucket_index(engine)]++] = std::move(value);
+        }
+    });
+    parallel_for(buckets, threads, [&](const std::size_t bucket) {
+        const std::size_t first = bucket_starts[bucket];
+        const std::span<Value> shuffled{scratch.get() + first, bucket_starts[bucket + 1] - first};
+        philox4x64 engine{seed_value, parallel_shuffle_bucket_stream + bucket};
+        Storm::shuffle(engine, shuffled, nearly_divisionless_mapping);
+        std::ranges::move(shuffled, values.begin() + static_cast<std::ptrdiff_t>(first));
+    });
+}
+
+}  // namespace detail
+
+// Shuffles a contiguous range in place on up to threads threads, or
+// std::thread::hardware_concurrency() threads when threads is zero. The
+// permutation depends only on the seed and the size, not the thread count.
+template<std::ranges::contiguous_range Range>
+    requires std::ranges::sized_range<Range> &&
+             std::permutable<std::ranges::iterator_t<Range>> &&
+             std::default_initializable<std::ranges::range_value_t<Range>> &&
+             std::is_nothrow_move_assignable_v<std::ranges::range_value_t<Range>> &&
+             std::is_nothrow_move_constructible_v<std::ranges::range_value_t<Range>>
+inline void parallel_shuffle(const std::uint64_t seed_value,
+                             Range&& range,
+                             const std::size_t threads = 0) {
+    using Value = std::ranges::range_value_t<Range>;
+    detail::parallel_shuffle(
+        seed_value,
+        std::span<Value>{std::ranges::data(range), std::ranges::size(range)},
+        threads,
+        detail::parallel_shuffle_block,
+        detail::parallel_shuffle_bucket);
+}
+
+namespace detail {
+
+// Vitter's Algorithm A: writes a sorted sample of output.size() indices from
+// [0, size) by scanning skip lengths one index at a time, in O(size) time.
+template<random_engine Engine>
+void sample_sequential_scan(Engine& engine,
+                            const std::size_t size,
+                            const std::size_t base,
+                            const std::span<std::size_t> output) noexcept {
+    const std::size_t remaining = output.size();
+    if (remaining == 0) {
+        return;
+    }
+    std::size_t current = base;
+    double top = static_cast<double>(size - remaining);
+    double population = static_cast<double>(size);
+    for (std::size_t& selected : output.first(remaining - 1)) {
+        const double draw = canonical_draw(engine);
+        std::size_t skip = 0;
+        double quotient = top / population;
+        while (quotient > draw) {
+            ++skip;
+            top -= 1.0;
+            population -= 1.0;
+            quotient = quotient * top / population;
+        }
+        current += skip;
+        selected = current++;
+        population -= 1.0;
+    }
+    const auto last_skip =
+        static_cast<std::size_t>(std::floor(std::round(population) * canonical_draw(engine)));
+    output.back() = current + last_skip;
+}
+
+// Vitter's Algorithm D: writes a sorted sample of output.size() indices from
+// [0, size) by drawing each skip length from its exact distribution with
+// rejection, in O(output.size()) expected time and constant extra space. It
+// hands the tail to Algorithm A once the population is under 13 times the
+// remaining sample, where scanning is cheaper.
+template<random_engine Engine>
+void sample_sequential(Engine& engine,
+                       std::size_t size,
+                       const std::span<std::size_t> output) noexcept {
+    constexpr std::size_t scan_ratio = 13;
+    std::size_t remaining = output.size();
+    if (remaining == 0) {
+        return;
+    }
+    std::size_t current = 0;
+    std::size_t written = 0;
+    double remaining_real = static_cast<double>(remaining);
+    double inverse = 1.0 / remaining_real;
+    double size_real = static_cast<double>(size);
+    std::size_t limit = size - remaining + 1;
+    double limit_real = static_cast<double>(limit);
+    double reused = std::exp(std::log(canonical_draw(engine)) * inverse);
+    while (remaining > 1 && remaining <= (size - 1) / scan_ratio) {
+        const double next_inverse = 1.0 / (remaining_real - 1.0);
+        std::size_t skip = 0;
+        for (;;) {
+            double scaled = 0.0;
+            for (;;) {
+                scaled = size_real * (1.0 - reused);
+                skip = static_cast<std::size_t>(scaled);
+                if (skip < limit) {
+                    break;
+                }
+                reused = std::exp(std::log(canonical_draw(engine)) * inverse);
+            }
+            const double draw = canonical_draw(engine);
+            const auto skip_real = static_cast<double>(skip);
+            const double first_bound =
+                std::exp(std::log(draw * size_real / limit_real) * next_inverse);
+            reused = first_bound * (1.0 - (scaled / size_real)) *
+                     (limit_real / (limit_real - skip_real));
+            if (reused <= 1.0) {
+                break;
+            }
+            double second_bound = 1.0;
+            double top = size_real - 1.0;
+            double bottom = 0.0;
+            std::size_t stop = 0;
+            if (remaining - 1 > skip) {
+                bottom = size_real - remaining_real;
+                stop = size - skip;
+            } else {
+                bottom = size_real - skip_real - 1.0;
+                stop = limit;
+            }
+            for (std::size_t term = size - 1; term >= stop; --term) {
+                second_bound = second_bound * top / bottom;
+                top -= 1.0;
+                bottom -= 1.0;
+            }
+            if (size_real / (size_real - scaled) >=
+                first_bound * std::exp(std::log(second_bound) * next_inverse)) {
+                reused = std::exp(std::log(canonical_draw(engine)) * next_inverse);
+                break;
+            }
+            reused = std::exp(std::log(canonical_draw(engine)) * inverse);
+        }
+        current += skip;
+        output[written++] = current++;
+        size -= skip + 1;
+        size_real = static_cast<double>(size);
+        --remaining;
+        remaining_real -= 1.0;
+        inverse = next_inverse;
+        limit -= skip;
+        limit_real = static_cast<double>(limit);
+    }
+    if (remaining > 1) {
+        sample_sequential_scan(engine, size, current, output.subspan(written));
+        return;
+    }
+    const auto last_skip = static_cast<std::size_t>(size_real * reused);
+    output[written] = current + std::min(last_skip, size - 1);
+}
+
+// Floyd's algorithm: for each candidate from size - count up to size - 1,
+// draws t below candidate + 1 and keeps t, or the candidate when t is
+// already kept. The set of kept indices is uniform over count-subsets.
+template<random_engine Engine>
+void sample_floyd(Engine& engine, const std::size_t size, const std::span<std::size_t> output) {
+    std::unordered_set<std::size_t> kept;
+    kept.reserve(output.size());
+    std::size_t written = 0;
+    for (std::size_t candidate = size - output.size(); candidate < size; ++candidate) {
+        std::size_t selected =
+            static_cast<std::size_t>(bounded(engine, static_cast<std::uint64_t>(candidate) + 1));
+        if (!kept.insert(selected).second) {
+            selected = candidate;
+            kept.insert(candidate);
+        }
+        output[written++] = selected;
+    }
+}
+
+}  // namespace detail
+
+// Writes count distinct indices from [0, size) into the first count elements
+// of output, each count-subset equally likely. Sorted order uses Vitter's
+// Algorithm D and no extra memory; random order uses Floyd's algorithm and
+// then shuffles the sample.
+template<random_engine Engine>
+inline void sample_indices(Engine& engine,
+                           const std::size_t size,
+                           const std::size_t count,
+                           const std::span<std::size_t> output,
+                           const sample_order order = sample_order::sorted) {
+    if (count > size) {
+        throw std::invalid_argument{"sample_indices requires count <= size"};
+    }
+    if (output.size() < count) {
+        throw std::invalid_argument{"sample_indices requires room for count indices"};
+    }
+    const std::span<std::size_t> sample = output.first(count);
+    if (order == sample_order::sorted) {
+        detail::sample_sequential(engine, size, sample);
+        return;
+    }
+    detail::sample_floyd(engine, size, sample);
+    shuffle(engine, sample);
+}
+
+inline void sample_indices(const std::size_t size,
+                           const std::size_t count,
+                           const std::span<std::size_t> output,
+                           const sample_order order = sample_order::sorted) {
+    sample_indices(thread_engine(), size, count, output, order);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto random_range(Engine& engine,
+                         const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const Mapping mapping) -> std::int64_t {
+    const detail::range_schedule schedule = detail::make_range_schedule(start, stop, step);
+    return schedule.value(detail::bounded(engine, schedule.count, mapping));
+}
+
+template<random_engine Engine>
+inline auto random_range(Engine& engine,
+                         const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step) -> std::int64_t {
+    return random_range(engine, start, stop, step, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto random_range(const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const Mapping mapping) -> std::int64_t {
+    return random_range(thread_engine(), start, stop, step, mapping);
 }
 
 inline auto random_range(const std::int64_t start,
@@ -387,20 +3472,74 @@ inline auto random_range(const std::int64_t start,
     return random_range(thread_engine(), start, stop, step);
 }
 
-inline auto roll_die(engine_type& engine, const std::size_t sides) -> std::size_t {
+template<bounded_mapping Mapping, random_engine Engine>
+inline void random_range(Engine& engine,
+                         const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const std::span<std::int64_t> output,
+                         const Mapping mapping) {
+    const detail::range_schedule schedule = detail::make_range_schedule(start, stop, step);
+    detail::bounded_fill(
+        engine, schedule.count, output,
+        [&schedule](const std::uint64_t offset) { return schedule.value(offset); }, mapping);
+}
+
+template<random_engine Engine>
+inline void random_range(Engine& engine,
+                         const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const std::span<std::int64_t> output) {
+    random_range(engine, start, stop, step, output, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline void random_range(const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const std::span<std::int64_t> output,
+                         const Mapping mapping) {
+    random_range(thread_engine(), start, stop, step, output, mapping);
+}
+
+inline void random_range(const std::int64_t start,
+                         const std::int64_t stop,
+                         const std::int64_t step,
+                         const std::span<std::int64_t> output) {
+    random_range(thread_engine(), start, stop, step, output);
+}
+
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto roll_die(Engine& engine, const std::size_t sides, const Mapping mapping)
+    -> std::size_t {
     if (sides == 0) {
         throw std::invalid_argument{"roll_die requires at least one side"};
     }
-    return static_cast<std::size_t>(detail::bounded(engine, static_cast<std::uint64_t>(sides))) +
+    return static_cast<std::size_t>(
+               detail::bounded(engine, static_cast<std::uint64_t>(sides), mapping)) +
            1U;
 }
 
+template<random_engine Engine>
+inline auto roll_die(Engine& engine, const std::size_t sides) -> std::size_t {
+    return roll_die(engine, sides, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto roll_die(const std::size_t sides, const Mapping mapping) -> std::size_t {
+    return roll_die(thread_engine(), sides, mapping);
+}
+
 inline auto roll_die(const std::size_t sides) -> std::size_t {
     return roll_die(thread_engine(), sides);
 }
 
-inline auto roll_dice(engine_type& engine, const std::size_t rolls, const std::size_t sides)
-    -> std::uint64_t {
+template<bounded_mapping Mapping, random_engine Engine>
+inline auto roll_dice(Engine& engine,
+                      const std::size_t rolls,
+                      const std::size_t sides,
+                      const Mapping mapping) -> std::uint64_t {
     if (sides == 0) {
         throw std::invalid_argument{"roll_dice requires at least one side"};
     }
@@ -415,16 +3554,29 @@ inline auto roll_dice(engine_type& engine, const std::size_t rolls, const std::s
     }
     std::uint64_t total = 0;
     for (std::size_t index = 0; index < rolls; ++index) {
-        total += static_cast<std::uint64_t>(roll_die(engine, sides));
+        total += static_cast<std::uint64_t>(roll_die(engine, sides, mapping));
     }
     return total;
 }
 
+template<random_engine Engine>
+inline auto roll_dice(Engine& engine, const std::size_t rolls, const std::size_t sides)
+    -> std::uint64_t {
+    return roll_dice(engine, rolls, sides, modulo_mapping);
+}
+
+template<bounded_mapping Mapping>
+inline auto roll_dice(const std::size_t rolls, const std::size_t sides, const Mapping mapping)
+    -> std::uint64_t {
+    return roll_dice(thread_engine(), rolls, sides, mapping);
+}
+
 inline auto roll_dice(const std::size_t rolls, const std::size_t sides) -> std::uint64_t {
     return roll_dice(thread_engine(), rolls, sides);
 }
 
-inline auto ability_dice(engine_type& engine, const std::size_t dice_count) -> std::uint64_t {
+template<random_engine Engine>
+inline auto ability_dice(Engine& engine, const std::size_t dice_count) -> std::uint64_t {
     if (dice_count < 3) {
         throw std::invalid_argument{"ability_dice requires at least three dice"};
     }
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// Poisson(width / 4) probabilities conditioned on [0, width).
+auto truncated_poisson(const std::size_t width) -> std::vector<double> {
+    const double mean = static_cast<double>(width) / 4.0;
+    std::vector<double> probabilities(width);
+    double total = 0.0;
+    for (std::size_t value = 0; value < width; ++value) {
+        const double log_probability = (static_cast<double>(value) * std::log(mean)) - mean -
+                                       std::lgamma(static_cast<double>(value) + 1.0);
+        probabilities[value] = std::exp(log_probability);
+        total += probabilities[value];
+    }
+    for (double& probability : probabilities) {
+        probability /= total;
+    }
+    return probabilities;
+}
+
+void test_api_and_invalid_domain() {
+    static_assert(std::is_constructible_v<Storm::alias_wide_index_selector,
+                                          Storm::engine_type&,
+                                          std::size_t>);
+    static_assert(noexcept(std::declval<Storm::alias_wide_index_selector&>()(
+        std::declval<Storm::engine_type&>())));
+
+    Storm::engine_type engine{std::uint64_t{17}};
+    const Storm::engine_type initial_state = engine;
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::alias_wide_index_selector(engine, std::size_t{0}));
+    STORM_CHECK(engine == initial_state);
+
+    Storm::alias_wide_index_selector size_one{engine, std::size_t{1}};
+    STORM_CHECK(size_one(engine) == 0U);
+}
+
+void test_table_matches_truncated_poisson() {
+    constexpr std::size_t samples = 400'000;
+    for (const std::size_t width : {std::size_t{1}, std::size_t{3}, std::size_t{10},
+                                    std::size_t{100}, std::size_t{1'000}}) {
+        const Storm::detail::truncated_poisson_table table{width};
+        const auto expected = truncated_poisson(width);
+        std::vector<std::size_t> counts(width);
+        Storm::engine_type engine{std::uint64_t{width}};
+        for (std::size_t draw = 0; draw < samples; ++draw) {
+            const std::size_t value = table(engine);
+            STORM_CHECK(value < width);
+            if (value < width) {
+                ++counts[value];
+            }
+        }
+        for (std::size_t value = 0; value < width; ++value) {
+            const double actual =
+                static_cast<double>(counts[value]) / static_cast<double>(samples);
+            const double deviation = 5.0 * std::sqrt(expected[value] / samples) + 1e-5;
+            STORM_CHECK(std::fabs(actual - expected[value]) <= deviation);
+        }
+    }
+}
+
+void test_shares_permutation_and_walks_backward() {
+    constexpr std::size_t size = 10'000;
+    constexpr std::size_t width = 100;
+    Storm::engine_type engine{std::uint64_t{0xA11A5}};
+    Storm::engine_type permutation_engine = engine;
+    Storm::engine_type wide_engine = engine;
+    Storm::alias_wide_index_selector selector{engine, size};
+    [[maybe_unused]] Storm::wide_index_selector wide{wide_engine, size};
+    STORM_CHECK(engine == wide_engine);
+
+    const auto permutation =
+        Storm::detail::make_wide_permutation<std::size_t>(permutation_engine, size);
+    std::vector<std::size_t> position(size);
+    for (std::size_t index = 0; index < size; ++index) {
+        position[permutation[index]] = index;
+    }
+
+    std::size_t cursor = size - 1;
+    std::vector<std::size_t> steps(width + 1);
+    for (std::size_t draw = 0; draw < 100'000; ++draw) {
+        const std::size_t next = position[selector(engine)];
+        const std::size_t step = (cursor + size - next) % size;
+        STORM_CHECK(step >= 1 && step <= width);
+        if (step >= 1 && step <= width) {
+            ++steps[step];
+        }
+        cursor = next;
+    }
+    const auto expected = truncated_poisson(width);
+    const double mode_share = static_cast<double>(steps[26]) / 100'000.0;
+    STORM_CHECK(std::fabs(mode_share - expected[25]) <= 0.005);
+}
+
+void test_reproducible_and_no_immediate_repeat() {
+    for (const std::size_t size : {std::size_t{2}, std::size_t{4}, std::size_t{1'000}}) {
+        Storm::engine_type first_engine{std::uint64_t{size}};
+        Storm::engine_type second_engine{std::uint64_t{size}};
+        Storm::alias_wide_index_selector first{first_engine, size};
+        Storm::alias_wide_index_selector second{second_engine, size};
+        std::size_t previous = size;
+        for (std::size_t draw = 0; draw < 10'000; ++draw) {
+            const std::size_t selected = first(first_engine);
+            STORM_CHECK(selected < size);
+            STORM_CHECK(selected != previous);
+            STORM_CHECK(selected == second(second_engine));
+            previous = selected;
+        }
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_api_and_invalid_domain();
+    test_table_matches_truncated_poisson();
+    test_shares_permutation_and_walks_backward();
+    test_reproducible_and_no_immediate_repeat();
+    return storm_test::finish();
+}
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+namespace {
+
+void test_engine_requirements() {
+    static_assert(Storm::random_engine<Storm::block_mt19937_64>);
+    static_assert(std::is_same_v<Storm::BlockGenerator::engine_type, Storm::block_mt19937_64>);
+    static_assert(Storm::block_mt19937_64::default_seed == std::mt19937_64::default_seed);
+    static_assert(Storm::block_mt19937_64::state_size == std::mt19937_64::state_size);
+}
+
+void test_matches_standard_sequence() {
+    constexpr std::array<std::uint64_t, 6> seeds{0, 1, 42, 5'489, 0xFFFF'FFFF'FFFF'FFFFULL,
+                                                 0xCAFE'F00D'1234'5678ULL};
+    for (const std::uint64_t seed : seeds) {
+        Storm::block_mt19937_64 block{seed};
+        std::mt19937_64 standard{seed};
+        for (std::size_t draw = 0; draw < 100'000; ++draw) {
+            STORM_CHECK(block() == standard());
+        }
+    }
+
+    Storm::block_mt19937_64 default_block;
+    std::mt19937_64 default_standard;
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(default_block() == default_standard());
+    }
+
+    std::seed_seq block_sequence{3U, 1U, 4U, 1U, 5U};
+    std::seed_seq standard_sequence{3U, 1U, 4U, 1U, 5U};
+    Storm::block_mt19937_64 sequenced{block_sequence};
+    std::mt19937_64 standard_sequenced{standard_sequence};
+    for (std::size_t draw = 0; draw < 10'000; ++draw) {
+        STORM_CHECK(sequenced() == standard_sequenced());
+    }
+}
+
+// A seed sequence producing only zero words exercises the all-zero state
+// correction in [rand.eng.mers].
+struct zero_sequence {
+    using result_type = std::uint32_t;
+
+    template<typename Iterator>
+    void generate(Iterator first, Iterator last) const {
+        for (; first != last; ++first) {
+            *first = 0;
+        }
+    }
+};
+
+void test_zero_state_correction() {
+    zero_sequence block_sequence;
+    zero_sequence standard_sequence;
+    Storm::block_mt19937_64 block{block_sequence};
+    std::mt19937_64 standard{standard_sequence};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(block() == standard());
+    }
+}
+
+void test_discard_and_equality() {
+    for (const unsigned long long skipped : {0ULL, 1ULL, 311ULL, 312ULL, 313ULL, 10'000ULL}) {
+        Storm::block_mt19937_64 block{7};
+        std::mt19937_64 standard{7};
+        static_cast<void>(block());
+        static_cast<void>(standard());
+        block.discard(skipped);
+        standard.discard(skipped);
+        for (std::size_t draw = 0; draw < 700; ++draw) {
+            STORM_CHECK(block() == standard());
+        }
+    }
+
+    Storm::block_mt19937_64 first{9};
+    Storm::block_mt19937_64 second{9};
+    STORM_CHECK(first == second);
+    static_cast<void>(first());
+    STORM_CHECK(!(first == second));
+    static_cast<void>(second());
+    STORM_CHECK(first == second);
+    second.seed(10);
+    STORM_CHECK(!(first == second));
+}
+
+void test_drop_in_for_generator() {
+    Storm::BlockGenerator block{2'026};
+    Storm::Generator standard{2'026};
+    const Storm::PreparedWeightedIndex weighted{{1.0, 0.0, 3.0, 2.0}};
+    for (std::size_t draw = 0; draw < 10'000; ++draw) {
+        STORM_CHECK(Storm::uniform_index(block.engine(), std::size_t{1'000}) ==
+                    Storm::uniform_index(standard.engine(), std::size_t{1'000}));
+        STORM_CHECK(Storm::canonical(block.engine()) == Storm::canonical(standard.engine()));
+        STORM_CHECK(weighted(block.engine()) == weighted(standard.engine()));
+        STORM_CHECK(Storm::roll_dice(block.engine(), 3, 6) ==
+                    Storm::roll_dice(standard.engine(), 3, 6));
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+#if defined(STORM_TEST_REQUIRE_AVX2) && (defined(__GNUC__) || defined(__clang__))
+    if (!__builtin_cpu_supports("avx2")) {
+        return 0;
+    }
+#endif
+    test_engine_requirements();
+    test_matches_standard_sequence();
+    test_zero_state_correction();
+    test_discard_and_equality();
+    test_drop_in_for_generator();
+    return storm_test::finish();
+}
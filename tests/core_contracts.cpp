@@ -8,9 +8,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <stdexcept>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 
 namespace {
 
@@ -330,6 +332,97 @@ void test_ability_dice_reference_equivalence() {
     }
 }
 
+void test_bulk_fill_matches_scalar_schedule() {
+    constexpr std::array<std::uint64_t, 3> seeds{0, 77, 0xB01C'F111'0000'0001ULL};
+    constexpr std::size_t count = 4'096;
+    constexpr std::array<std::size_t, 6> index_bounds{
+        1U, 6U, 7U, 64U, 1'000U, std::numeric_limits<std::size_t>::max()};
+
+    for (const std::uint64_t seed_value : seeds) {
+        for (const std::size_t size : index_bounds) {
+            Storm::engine_type bulk_engine{seed_value};
+            Storm::engine_type scalar_engine{seed_value};
+            std::vector<std::size_t> bulk(count);
+            Storm::uniform_index(bulk_engine, size, bulk);
+            for (const std::size_t value : bulk) {
+                STORM_CHECK(value == Storm::uniform_index(scalar_engine, size));
+            }
+            STORM_CHECK(bulk_engine == scalar_engine);
+        }
+
+        Storm::engine_type bulk_engine{seed_value};
+        Storm::engine_type scalar_engine{seed_value};
+        std::vector<unsigned_type> unsigned_values(count);
+        Storm::uniform_unsigned(bulk_engine, unsigned_type{0}, unsigned_max, unsigned_values);
+        for (const unsigned_type value : unsigned_values) {
+            STORM_CHECK(value ==
+                        Storm::uniform_unsigned(scalar_engine, unsigned_type{0}, unsigned_max));
+        }
+        Storm::uniform_unsigned(bulk_engine, unsigned_type{10}, unsigned_type{19}, unsigned_values);
+        for (const unsigned_type value : unsigned_values) {
+            STORM_CHECK(value == Storm::uniform_unsigned(
+                                     scalar_engine, unsigned_type{10}, unsigned_type{19}));
+        }
+        STORM_CHECK(bulk_engine == scalar_engine);
+
+        std::vector<signed_type> integer_values(count);
+        Storm::uniform_integer(bulk_engine, integer_min, integer_max, integer_values);
+        for (const signed_type value : integer_values) {
+            STORM_CHECK(value == Storm::uniform_integer(scalar_engine, integer_min, integer_max));
+        }
+        Storm::uniform_integer(bulk_engine, -5, 5, integer_values);
+        for (const signed_type value : integer_values) {
+            STORM_CHECK(value == Storm::uniform_integer(scalar_engine, -5, 5));
+        }
+        STORM_CHECK(bulk_engine == scalar_engine);
+
+        std::vector<signed_type> range_values(count);
+        Storm::random_range(bulk_engine, -9, 10, 3, range_values);
+        for (const signed_type value : range_values) {
+            STORM_CHECK(value == Storm::random_range(scalar_engine, -9, 10, 3));
+        }
+        Storm::random_range(bulk_engine, integer_max, integer_min, integer_min, range_values);
+        for (const signed_type value : range_values) {
+            STORM_CHECK(value ==
+                        Storm::random_range(scalar_engine, integer_max, integer_min, integer_min));
+        }
+        STORM_CHECK(bulk_engine == scalar_engine);
+    }
+
+    Storm::seed(unsigned_type{606});
+    std::array<std::size_t, 16> tls_bulk{};
+    Storm::uniform_index(std::size_t{7}, tls_bulk);
+    Storm::Generator control{unsigned_type{606}};
+    for (const std::size_t value : tls_bulk) {
+        STORM_CHECK(value == Storm::uniform_index(control.engine(), std::size_t{7}));
+    }
+}
+
+void test_bulk_fill_validation() {
+    Storm::engine_type engine{unsigned_type{707}};
+    const Storm::engine_type initial_state = engine;
+    std::array<std::size_t, 4> indices{};
+    std::array<unsigned_type, 4> unsigned_values{};
+    std::array<signed_type, 4> signed_values{};
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_index(engine, std::size_t{0}, indices));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_unsigned(engine, unsigned_type{1}, unsigned_type{0},
+                                                unsigned_values));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_integer(engine, 1, -1, signed_values));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::random_range(engine, 0, 10, 0, signed_values));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::random_range(engine, 10, 0, 1, signed_values));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_index(engine, std::size_t{0}, std::span<std::size_t>{}));
+    STORM_CHECK(engine == initial_state);
+
+    Storm::uniform_index(engine, std::size_t{7}, std::span<std::size_t>{});
+    STORM_CHECK(engine == initial_state);
+}
+
 }  // namespace
 
 auto main() -> int {
@@ -343,5 +436,7 @@ auto main() -> int {
     test_directed_ranges();
     test_dice();
     test_ability_dice_reference_equivalence();
+    test_bulk_fill_matches_scalar_schedule();
+    test_bulk_fill_validation();
     return storm_test::finish();
 }
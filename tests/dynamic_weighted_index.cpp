@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// Reference selection: the first entry whose inclusive prefix sum exceeds the
+// scaled draw, skipping zero weights. It is exact for dyadic weights.
+auto reference_select(const std::vector<double>& weights, const double draw) -> std::size_t {
+    double prefix = 0.0;
+    for (std::size_t index = 0; index < weights.size(); ++index) {
+        prefix += weights[index];
+        if (draw < prefix) {
+            return index;
+        }
+    }
+    return weights.size();
+}
+
+void test_validation_and_construction_engine_state() {
+    Storm::seed(std::uint64_t{901});
+    const Storm::engine_type initial_thread_state = Storm::thread_engine();
+    const Storm::DynamicWeightedIndex integer_weights{std::array{1, 2, 3}};
+    STORM_CHECK(Storm::thread_engine() == initial_thread_state);
+    STORM_CHECK(integer_weights.size() == 3U);
+    STORM_CHECK(integer_weights.total() == 6.0);
+    STORM_CHECK(integer_weights.weight(1) == 2.0);
+
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::DynamicWeightedIndex(std::initializer_list<double>{}));
+    STORM_EXPECT_THROWS(std::invalid_argument, Storm::DynamicWeightedIndex({0.0, 0.0, 0.0}));
+    STORM_EXPECT_THROWS(std::invalid_argument, Storm::DynamicWeightedIndex({1.0, -1.0}));
+    STORM_EXPECT_THROWS(
+        std::invalid_argument,
+        Storm::DynamicWeightedIndex({1.0, std::numeric_limits<double>::quiet_NaN()}));
+    STORM_EXPECT_THROWS(
+        std::invalid_argument,
+        Storm::DynamicWeightedIndex({1.0, std::numeric_limits<double>::infinity()}));
+    STORM_EXPECT_THROWS(std::overflow_error,
+                        Storm::DynamicWeightedIndex({std::numeric_limits<double>::max(),
+                                                     std::numeric_limits<double>::max()}));
+    STORM_CHECK(Storm::thread_engine() == initial_thread_state);
+
+    static_assert(!noexcept(Storm::DynamicWeightedIndex({1.0})));
+    static_assert(noexcept(std::declval<const Storm::DynamicWeightedIndex&>()(
+        std::declval<Storm::engine_type&>())));
+    static_assert(std::is_same_v<decltype(std::declval<const Storm::DynamicWeightedIndex&>()(
+                                     std::declval<Storm::engine_type&>())),
+                                 std::size_t>);
+}
+
+void test_update_validation_preserves_state() {
+    Storm::DynamicWeightedIndex dynamic{{0.0, 2.0, 0.0}};
+    STORM_EXPECT_THROWS(std::out_of_range, dynamic.set_weight(3, 1.0));
+    STORM_EXPECT_THROWS(std::out_of_range, dynamic.remove(3));
+    STORM_EXPECT_THROWS(std::out_of_range, static_cast<void>(dynamic.weight(3)));
+    STORM_EXPECT_THROWS(std::invalid_argument, dynamic.set_weight(0, -1.0));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        dynamic.set_weight(0, std::numeric_limits<double>::quiet_NaN()));
+    STORM_EXPECT_THROWS(std::invalid_argument, dynamic.add(-1.0));
+    STORM_EXPECT_THROWS(std::invalid_argument, dynamic.set_weight(1, 0.0));
+    STORM_EXPECT_THROWS(std::invalid_argument, dynamic.remove(1));
+    STORM_CHECK(dynamic.size() == 3U);
+    STORM_CHECK(dynamic.total() == 2.0);
+    STORM_CHECK(dynamic.weight(0) == 0.0);
+    STORM_CHECK(dynamic.weight(1) == 2.0);
+    STORM_CHECK(dynamic.weight(2) == 0.0);
+
+    dynamic.set_weight(0, std::numeric_limits<double>::max());
+    STORM_EXPECT_THROWS(std::overflow_error,
+                        dynamic.set_weight(2, std::numeric_limits<double>::max()));
+    STORM_EXPECT_THROWS(std::overflow_error, dynamic.add(std::numeric_limits<double>::max()));
+    STORM_CHECK(dynamic.size() == 3U);
+    STORM_CHECK(dynamic.weight(2) == 0.0);
+    STORM_CHECK(dynamic.total() == std::numeric_limits<double>::max() + 2.0);
+
+    // A sum that rounds back to max is rejected, as the prepared selectors do.
+    constexpr double max = std::numeric_limits<double>::max();
+    STORM_EXPECT_THROWS(std::overflow_error, Storm::PreparedAliasWeightedIndex({max, 1.0}));
+    Storm::DynamicWeightedIndex saturated{{max, 0.0}};
+    STORM_EXPECT_THROWS(std::overflow_error, saturated.add(1.0));
+    STORM_EXPECT_THROWS(std::overflow_error, saturated.set_weight(1, 1.0));
+    STORM_CHECK(saturated.size() == 2U);
+    STORM_CHECK(saturated.weight(1) == 0.0);
+    saturated.set_weight(0, max / 2.0);
+    saturated.set_weight(1, max / 2.0);
+    STORM_CHECK(saturated.total() == max);
+
+    Storm::DynamicWeightedIndex single{{5.0}};
+    STORM_EXPECT_THROWS(std::invalid_argument, single.remove(0));
+    STORM_CHECK(single.size() == 1U);
+}
+
+void test_updates_match_reference() {
+    std::vector<double> weights{1.0, 0.0, 3.0};
+    Storm::DynamicWeightedIndex dynamic{weights};
+    Storm::engine_type mutation_engine{std::uint64_t{0xD11A'0007}};
+    Storm::engine_type actual_engine{std::uint64_t{77}};
+    Storm::engine_type reference_engine{std::uint64_t{77}};
+    for (std::size_t step = 0; step < 20'000; ++step) {
+        const auto weight =
+            static_cast<double>(Storm::uniform_index(mutation_engine, std::size_t{9}));
+        switch (Storm::uniform_index(mutation_engine, std::size_t{4})) {
+        case 0: {
+            const std::size_t index = Storm::uniform_index(mutation_engine, weights.size());
+            double others = 0.0;
+            for (std::size_t other = 0; other < weights.size(); ++other) {
+                others += other == index ? 0.0 : weights[other];
+            }
+            if (weight > 0.0 || others > 0.0) {
+                dynamic.set_weight(index, weight);
+                weights[index] = weight;
+            }
+            break;
+        }
+        case 1:
+            STORM_CHECK(dynamic.add(weight) == weights.size());
+            weights.push_back(weight);
+            break;
+        case 2: {
+            const std::size_t index = Storm::uniform_index(mutation_engine, weights.size());
+            double remaining = 0.0;
+            for (std::size_t other = 0; other < weights.size(); ++other) {
+                remaining += other == index ? 0.0 : weights[other];
+            }
+            if (weights.size() > 1U && remaining > 0.0) {
+                dynamic.remove(index);
+                weights[index] = weights.back();
+                weights.pop_back();
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        STORM_CHECK(dynamic.size() == weights.size());
+        double total = 0.0;
+        for (std::size_t index = 0; index < weights.size(); ++index) {
+            STORM_CHECK(dynamic.weight(index) == weights[index]);
+            total += weights[index];
+        }
+        STORM_CHECK(dynamic.total() == total);
+
+        const std::size_t selected = dynamic(actual_engine);
+        const double draw = Storm::canonical(reference_engine) * total;
+        STORM_CHECK(selected == reference_select(weights, draw));
+        STORM_CHECK(actual_engine == reference_engine);
+    }
+}
+
+void test_zero_weights_are_never_selected() {
+    Storm::DynamicWeightedIndex dynamic{{0.0, 1.0, 0.0, 4.0, 0.0}};
+    dynamic.add(0.0);
+    dynamic.add(std::numeric_limits<double>::denorm_min());
+    dynamic.set_weight(3, 0.0);
+    Storm::engine_type engine{std::uint64_t{808}};
+    for (std::size_t draw = 0; draw < 100'000; ++draw) {
+        const std::size_t selected = dynamic(engine);
+        STORM_CHECK(selected == 1U || selected == 6U);
+    }
+
+    Storm::DynamicWeightedIndex subnormal{{0.0, std::numeric_limits<double>::denorm_min()}};
+    for (std::size_t draw = 0; draw < 10'000; ++draw) {
+        STORM_CHECK(subnormal(engine) == 1U);
+    }
+}
+
+void test_frequencies() {
+    constexpr std::size_t samples = 200'000;
+    constexpr std::array<double, 5> weights{1.0, 3.0, 0.0, 6.0, 10.0};
+    constexpr double tolerance = 0.01;
+    Storm::DynamicWeightedIndex dynamic{{5.0, 5.0}};
+    dynamic.set_weight(0, weights[0]);
+    dynamic.set_weight(1, weights[1]);
+    for (std::size_t index = 2; index < weights.size(); ++index) {
+        dynamic.add(weights[index]);
+    }
+    std::array<std::size_t, weights.size()> buckets{};
+    Storm::engine_type engine{std::uint64_t{9'876'543}};
+    for (std::size_t draw = 0; draw < samples; ++draw) {
+        ++buckets[dynamic(engine)];
+    }
+    for (std::size_t index = 0; index < buckets.size(); ++index) {
+        const double actual =
+            static_cast<double>(buckets[index]) / static_cast<double>(samples);
+        STORM_CHECK(std::fabs(actual - weights[index] / 20.0) <= tolerance);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_validation_and_construction_engine_state();
+    test_update_validation_preserves_state();
+    test_updates_match_reference();
+    test_zero_weights_are_never_selected();
+    test_frequencies();
+    return storm_test::finish();
+}
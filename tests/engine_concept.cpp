@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Storm::Generator stays a class, so existing forward declarations still compile.
+namespace Storm {
+class Generator;
+}  // namespace Storm
+
+namespace {
+
+// Hands xoshiro256pp::seed the 32-bit words of a chosen state, high half first.
+struct fixed_state_sequence {
+    using result_type = std::uint32_t;
+
+    std::array<std::uint32_t, 8> words;
+
+    template<typename Iterator>
+    void generate(Iterator first, const Iterator last) const {
+        for (std::size_t index = 0; first != last; ++first, ++index) {
+            *first = words[index % words.size()];
+        }
+    }
+};
+
+// First outputs of Blackman and Vigna's xoshiro256plusplus.c from state
+// {1, 2, 3, 4}, also the reference vector of the rand_xoshiro crate.
+constexpr std::array<std::uint64_t, 10> xoshiro_counting_state{
+    41'943'041ULL,
+    58'720'359ULL,
+    3'588'806'011'781'223ULL,
+    3'591'011'842'654'386ULL,
+    9'228'616'714'210'784'205ULL,
+    9'973'669'472'204'895'162ULL,
+    14'011'001'112'246'962'877ULL,
+    12'406'186'145'184'390'807ULL,
+    15'849'039'046'786'891'736ULL,
+    10'450'023'813'501'588'000ULL,
+};
+
+// Outputs 0-3 and 9999 of xoshiro256plusplus.c from the splitmix64_zero state.
+constexpr std::array<std::uint64_t, 4> xoshiro_splitmix_zero{
+    0x5317'5D61'490B'23DFULL,
+    0x61DA'6F3D'C380'D507ULL,
+    0x5C0F'DF91'EC9A'7BFCULL,
+    0x02EE'BF8C'3BBE'5E1AULL,
+};
+constexpr std::uint64_t xoshiro_splitmix_zero_9999 = 0x619D'F8B7'CDD5'C1A7ULL;
+
+// Outputs of splitmix64.c seeded with zero.
+constexpr std::array<std::uint64_t, 4> splitmix64_zero{
+    0xE220'A839'7B1D'CDAFULL,
+    0x6E78'9E6A'A1B9'65F4ULL,
+    0x06C4'5D18'8009'454FULL,
+    0xF88B'B8A8'724C'81ECULL,
+};
+
+void test_concept() {
+    static_assert(Storm::random_engine<Storm::engine_type>);
+    static_assert(Storm::random_engine<Storm::xoshiro256pp>);
+    static_assert(!Storm::random_engine<std::mt19937>);
+    static_assert(!Storm::random_engine<std::minstd_rand>);
+    static_assert(!Storm::random_engine<const Storm::xoshiro256pp>);
+    static_assert(std::is_base_of_v<Storm::BasicGenerator<Storm::engine_type>, Storm::Generator>);
+    static_assert(std::is_same_v<Storm::Generator::engine_type, Storm::engine_type>);
+    static_assert(
+        std::is_same_v<Storm::FastGenerator::engine_type, Storm::xoshiro256pp>);
+    static_assert(sizeof(Storm::xoshiro256pp) == 32U);
+    static_assert(Storm::random_engine<Storm::splitmix64>);
+    static_assert(std::is_same_v<Storm::KeyedGenerator::engine_type, Storm::splitmix64>);
+    static_assert(sizeof(Storm::splitmix64) == 8U);
+}
+
+void test_xoshiro_known_answers() {
+    std::uint64_t state = 0;
+    for (const std::uint64_t expected : splitmix64_zero) {
+        STORM_CHECK(Storm::detail::splitmix64(state) == expected);
+    }
+
+    fixed_state_sequence counting_sequence{{0, 1, 0, 2, 0, 3, 0, 4}};
+    Storm::xoshiro256pp counting{counting_sequence};
+    for (const std::uint64_t expected : xoshiro_counting_state) {
+        STORM_CHECK(counting() == expected);
+    }
+
+    // Seed zero expands through SplitMix64 to the four words above.
+    Storm::xoshiro256pp engine{0};
+    for (const std::uint64_t expected : xoshiro_splitmix_zero) {
+        STORM_CHECK(engine() == expected);
+    }
+    engine.discard(9'999 - xoshiro_splitmix_zero.size());
+    STORM_CHECK(engine() == xoshiro_splitmix_zero_9999);
+    STORM_CHECK(Storm::xoshiro256pp{} == Storm::xoshiro256pp{0});
+}
+
+void test_xoshiro_engine_requirements() {
+    Storm::xoshiro256pp first{42};
+    Storm::xoshiro256pp second{42};
+    first.discard(1'000);
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        static_cast<void>(second());
+    }
+    STORM_CHECK(first == second);
+    second.seed(42);
+    STORM_CHECK(!(first == second));
+
+    std::seed_seq sequence{1U, 2U, 3U};
+    Storm::xoshiro256pp seeded{sequence};
+    std::seed_seq same_sequence{1U, 2U, 3U};
+    Storm::xoshiro256pp reseeded{7};
+    reseeded.seed(same_sequence);
+    STORM_CHECK(seeded == reseeded);
+}
+
+void test_splitmix64_engine() {
+    Storm::splitmix64 engine{0};
+    for (const std::uint64_t expected : splitmix64_zero) {
+        STORM_CHECK(engine() == expected);
+    }
+    STORM_CHECK(Storm::splitmix64{} == Storm::splitmix64{0});
+
+    Storm::splitmix64 skipped{99};
+    Storm::splitmix64 stepped{99};
+    skipped.discard(1'000);
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        static_cast<void>(stepped());
+    }
+    STORM_CHECK(skipped == stepped);
+    STORM_CHECK(skipped() == stepped());
+
+    // Keys one increment apart would otherwise be the same stream, one draw apart.
+    constexpr std::uint64_t key = 12'345;
+    Storm::splitmix64 keyed{key};
+    Storm::splitmix64 shifted_key{key + 0x9E37'79B9'7F4A'7C15ULL};
+    std::vector<std::uint64_t> keyed_outputs(1'000);
+    for (std::uint64_t& output : keyed_outputs) {
+        output = keyed();
+    }
+    for (std::size_t draw = 0; draw < 8; ++draw) {
+        STORM_CHECK(std::ranges::find(keyed_outputs, shifted_key()) == keyed_outputs.end());
+    }
+
+    std::seed_seq sequence{4U, 5U};
+    Storm::splitmix64 seeded{sequence};
+    std::seed_seq same_sequence{4U, 5U};
+    Storm::splitmix64 reseeded{1};
+    reseeded.seed(same_sequence);
+    STORM_CHECK(seeded == reseeded);
+
+    Storm::KeyedGenerator first_request{1};
+    Storm::KeyedGenerator second_request{2};
+    STORM_CHECK(Storm::uniform_index(first_request.engine(), std::size_t{1'000'000}) !=
+                Storm::uniform_index(second_request.engine(), std::size_t{1'000'000}));
+    const Storm::PreparedAliasWeightedIndex alias{{0.0, 1.0, 2.0}};
+    STORM_CHECK(alias(first_request.engine()) != 0U);
+    STORM_CHECK(Storm::canonical(second_request.engine()) < 1.0);
+}
+
+void test_generic_algorithms_follow_the_engine() {
+    Storm::xoshiro256pp engine{2026};
+    Storm::xoshiro256pp raw{2026};
+    constexpr std::uint64_t bound = 6;
+    constexpr std::uint64_t threshold = (0 - bound) % bound;
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        std::uint64_t value = raw();
+        while (value < threshold) {
+            value = raw();
+        }
+        STORM_CHECK(Storm::uniform_index(engine, std::size_t{6}) == value % bound);
+        STORM_CHECK(Storm::canonical(engine) ==
+                    static_cast<double>(raw() >> 11U) * 0x1.0p-53);
+    }
+
+    std::array<std::size_t, 64> bulk{};
+    std::array<std::size_t, 64> scalar{};
+    Storm::xoshiro256pp bulk_engine{3};
+    Storm::xoshiro256pp scalar_engine{3};
+    Storm::uniform_index(bulk_engine, std::size_t{1'000}, std::span<std::size_t>{bulk});
+    for (std::size_t& value : scalar) {
+        value = Storm::uniform_index(scalar_engine, std::size_t{1'000});
+    }
+    STORM_CHECK(bulk == scalar);
+    STORM_CHECK(bulk_engine == scalar_engine);
+}
+
+void test_selectors_accept_any_engine() {
+    Storm::FastGenerator generator{11};
+    Storm::xoshiro256pp& engine = generator.engine();
+    const Storm::PreparedWeightedIndex weighted{{0.0, 1.0, 2.0}};
+    const Storm::PreparedCumulativeWeightedIndex cumulative{{0.0, 1.0, 3.0}};
+    const Storm::PreparedAliasWeightedIndex alias{{0.0, 1.0, 2.0}};
+    const Storm::PreparedUniformIndex uniform{7};
+    Storm::DynamicWeightedIndex dynamic{{0.0, 1.0, 2.0}};
+    Storm::wide_index_selector selector{engine, 100};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(weighted(engine) != 0U);
+        STORM_CHECK(cumulative(engine) != 0U);
+        STORM_CHECK(alias(engine) != 0U);
+        STORM_CHECK(dynamic(engine) != 0U);
+        STORM_CHECK(uniform(engine) < 7U);
+        STORM_CHECK(selector(engine) < 100U);
+        const std::uint64_t dice = Storm::roll_dice(engine, 3, 6);
+        STORM_CHECK(dice >= 3U && dice <= 18U);
+        const std::int64_t ranged = Storm::random_range(engine, -10, 10, 3);
+        STORM_CHECK(ranged >= -10 && ranged < 10 && (ranged + 10) % 3 == 0);
+    }
+    std::vector<std::size_t> many(100);
+    weighted.select_many(engine, std::span<std::size_t>{many});
+    STORM_CHECK(weighted.sample_counts(engine, 50)[0] == 0U);
+
+    Storm::FastGenerator copied = generator;
+    STORM_CHECK(copied.engine() == generator.engine());
+    STORM_CHECK(Storm::uniform_index(copied.engine(), std::size_t{1'000}) ==
+                Storm::uniform_index(generator.engine(), std::size_t{1'000}));
+    generator.seed(11);
+    STORM_CHECK(generator.engine() == Storm::xoshiro256pp{11});
+    generator.reseed_from_entropy();
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_concept();
+    test_xoshiro_known_answers();
+    test_xoshiro_engine_requirements();
+    test_splitmix64_engine();
+    test_generic_algorithms_follow_the_engine();
+    test_selectors_accept_any_engine();
+    return storm_test::finish();
+}
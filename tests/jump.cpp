@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template<typename Left, typename Right>
+auto same_outputs(Left& left, Right& right, const std::size_t count) -> bool {
+    bool same = true;
+    for (std::size_t draw = 0; draw < count; ++draw) {
+        same = left() == right() && same;
+    }
+    return same;
+}
+
+void test_untemper_inverts_temper() {
+    using parameters = Storm::detail::mt19937_64_parameters;
+    std::mt19937_64 source{std::uint64_t{3}};
+    for (std::size_t draw = 0; draw < 10'000; ++draw) {
+        const std::uint64_t word = source();
+        STORM_CHECK(parameters::untemper(parameters::temper(word)) == word);
+        STORM_CHECK(parameters::temper(parameters::untemper(word)) == word);
+    }
+}
+
+void test_characteristic_polynomial_annihilates_low_bits() {
+    constexpr std::size_t degree = Storm::detail::mt19937_64_degree;
+    std::mt19937_64 source{std::uint64_t{77}};
+    std::array<std::uint8_t, degree + 64> bits{};
+    for (auto& bit : bits) {
+        bit = static_cast<std::uint8_t>(source() & 1U);
+    }
+    for (std::size_t start = 0; start < 64; ++start) {
+        auto sum = static_cast<unsigned>(bits[start + degree]);
+        for (const std::uint16_t term : Storm::detail::mt19937_64_characteristic_terms) {
+            sum ^= bits[start + term];
+        }
+        STORM_CHECK(sum == 0U);
+    }
+}
+
+void test_window_sequence_meets_seed_sequence_requirements() {
+    using sequence = Storm::detail::mt19937_64_window_sequence;
+    static_assert(std::is_default_constructible_v<sequence>);
+    static_assert(std::is_constructible_v<sequence, const std::uint32_t*, const std::uint32_t*>);
+    static_assert(std::is_constructible_v<sequence, std::initializer_list<std::uint32_t>>);
+
+    Storm::detail::mt19937_64_window window{};
+    for (std::size_t index = 0; index < window.size(); ++index) {
+        window[index] = 0x0123'4567'89AB'CDEFULL * (index + 1);
+    }
+    const sequence from_window(window);
+    STORM_CHECK(from_window.size() == 2 * window.size());
+    std::vector<std::uint32_t> words(from_window.size());
+    from_window.param(words.begin());
+    STORM_CHECK(words[0] == static_cast<std::uint32_t>(window[0]));
+    STORM_CHECK(words[1] == static_cast<std::uint32_t>(window[0] >> 32U));
+
+    const sequence copied(words.begin(), words.end());
+    std::vector<std::uint32_t> generated(words.size());
+    copied.generate(generated.begin(), generated.end());
+    STORM_CHECK(generated == words);
+    const sequence empty{};
+    STORM_CHECK(empty.size() == 0U);
+}
+
+void test_jump_matches_discard() {
+    constexpr std::array<std::uint64_t, 14> steps{
+        0, 1, 2, 155, 311, 312, 313, 624, 1'000, 19'937, 20'249, 20'250, 123'457, 5'000'011};
+    for (const std::uint64_t step : steps) {
+        for (const std::size_t offset : {std::size_t{0}, std::size_t{1}, std::size_t{200}}) {
+            Storm::engine_type jumped{std::uint64_t{2024} + offset};
+            Storm::engine_type discarded = jumped;
+            jumped.discard(offset);
+            discarded.discard(offset + step);
+            Storm::jump(jumped, step);
+            STORM_CHECK(same_outputs(jumped, discarded, 1'000));
+        }
+    }
+}
+
+void test_polynomial_path_matches_discard_for_small_steps() {
+    for (std::uint64_t step = 312; step < 1'200; step += 37) {
+        Storm::engine_type jumped{std::uint64_t{55}};
+        Storm::engine_type discarded = jumped;
+        Storm::detail::apply_mt19937_64_jump(jumped,
+                                             Storm::detail::mt19937_64_power(step - 312));
+        discarded.discard(step);
+        STORM_CHECK(same_outputs(jumped, discarded, 700));
+    }
+}
+
+void test_jumps_compose() {
+    constexpr std::uint64_t first = 0x1234'5678'9ABC'DEF0ULL;
+    constexpr std::uint64_t second = 0x0FED'CBA9'8765'4321ULL;
+    Storm::engine_type split{std::uint64_t{9}};
+    Storm::engine_type whole = split;
+    Storm::jump(split, first);
+    Storm::jump(split, second);
+    Storm::jump(whole, first + second);
+    STORM_CHECK(same_outputs(split, whole, 1'000));
+}
+
+void test_block_engine_jumps_like_std() {
+    Storm::block_mt19937_64 block{std::uint64_t{31}};
+    Storm::engine_type standard{std::uint64_t{31}};
+    block.discard(17);
+    standard.discard(17);
+    Storm::jump(block, 987'654'321);
+    Storm::jump(standard, 987'654'321);
+    STORM_CHECK(same_outputs(block, standard, 1'000));
+    Storm::jump_substream(block);
+    Storm::jump_substream(standard);
+    STORM_CHECK(same_outputs(block, standard, 1'000));
+}
+
+void test_substream_polynomial_is_two_to_the_128() {
+    // x^(2^64) squared 64 times is x^(2^128); the table is that times x^-312.
+    auto expected = Storm::detail::mt19937_64_power(~std::uint64_t{0});
+    Storm::detail::mt19937_64_multiply_x(expected);
+    for (int square = 0; square < 64; ++square) {
+        Storm::detail::mt19937_64_square(expected);
+    }
+    auto actual = Storm::detail::mt19937_64_substream_jump;
+    for (int shift = 0; shift < 312; ++shift) {
+        Storm::detail::mt19937_64_multiply_x(actual);
+    }
+    STORM_CHECK(actual == expected);
+}
+
+void test_substreams_are_reproducible_and_distinct() {
+    Storm::Generator base{std::uint64_t{404}};
+    Storm::Generator first = base;
+    Storm::Generator second = base;
+    Storm::jump_substream(first.engine());
+    Storm::jump_substream(second.engine());
+    STORM_CHECK(first.engine() == second.engine());
+    STORM_CHECK(first.engine()() != base.engine()());
+    Storm::jump_substream(second.engine());
+    STORM_CHECK(second.engine()() != first.engine()());
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_untemper_inverts_temper();
+    test_characteristic_polynomial_annihilates_low_bits();
+    test_window_sequence_meets_seed_sequence_requirements();
+    test_jump_matches_discard();
+    test_polynomial_path_matches_discard_for_small_steps();
+    test_jumps_compose();
+    test_block_engine_jumps_like_std();
+    test_substream_polynomial_is_two_to_the_128();
+    test_substreams_are_reproducible_and_distinct();
+    return storm_test::finish();
+}
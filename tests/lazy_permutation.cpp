@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+void test_api_and_invalid_domain() {
+    static_assert(std::forward_iterator<Storm::lazy_permutation::iterator>);
+    static_assert(std::ranges::forward_range<const Storm::lazy_permutation>);
+    static_assert(!std::is_constructible_v<Storm::lazy_permutation, std::uint64_t>);
+
+    Storm::engine_type engine{std::uint64_t{5}};
+    const Storm::engine_type initial_state = engine;
+    STORM_EXPECT_THROWS(std::invalid_argument, Storm::lazy_permutation(engine, 0));
+    STORM_CHECK(engine == initial_state);
+
+    const Storm::lazy_permutation permutation{engine, 10};
+    Storm::engine_type expected = initial_state;
+    expected.discard(Storm::lazy_permutation::rounds);
+    STORM_CHECK(engine == expected);
+    STORM_CHECK(permutation.size() == 10U);
+    STORM_EXPECT_THROWS(std::out_of_range, static_cast<void>(permutation.at(10)));
+
+    const Storm::lazy_permutation single{engine, 1};
+    STORM_CHECK(single.at(0) == 0U);
+}
+
+void test_is_a_bijection() {
+    for (const std::uint64_t size : {std::uint64_t{2}, std::uint64_t{3}, std::uint64_t{5},
+                                     std::uint64_t{100}, std::uint64_t{1'000},
+                                     std::uint64_t{4'097}, std::uint64_t{65'537}}) {
+        Storm::engine_type engine{size};
+        const Storm::lazy_permutation permutation{engine, size};
+        std::vector<bool> seen(static_cast<std::size_t>(size));
+        bool bijective = true;
+        std::uint64_t position = 0;
+        for (const std::uint64_t value : permutation) {
+            bijective = bijective && value < size && !seen[static_cast<std::size_t>(value)] &&
+                        value == permutation.at(position);
+            if (value < size) {
+                seen[static_cast<std::size_t>(value)] = true;
+            }
+            ++position;
+        }
+        STORM_CHECK(bijective);
+        STORM_CHECK(position == size);
+    }
+}
+
+void test_keyed_by_engine() {
+    Storm::engine_type first_engine{std::uint64_t{42}};
+    Storm::engine_type second_engine{std::uint64_t{42}};
+    Storm::engine_type other_engine{std::uint64_t{43}};
+    const Storm::lazy_permutation first{first_engine, 1'000};
+    const Storm::lazy_permutation second{second_engine, 1'000};
+    const Storm::lazy_permutation other{other_engine, 1'000};
+    STORM_CHECK(std::ranges::equal(first, second));
+    STORM_CHECK(!std::ranges::equal(first, other));
+    const auto identity = std::views::iota(std::uint64_t{0}, std::uint64_t{1'000});
+    STORM_CHECK(!std::ranges::equal(first, identity));
+}
+
+void test_large_domain_in_constant_memory() {
+    constexpr std::uint64_t size = std::uint64_t{1} << 40U;
+    Storm::engine_type engine{std::uint64_t{0x2040}};
+    const Storm::lazy_permutation permutation{engine, size};
+    static_assert(sizeof(Storm::lazy_permutation) <= 128);
+    std::vector<std::uint64_t> values;
+    for (std::uint64_t position = size - 1'000; position < size; ++position) {
+        values.push_back(permutation[position]);
+    }
+    STORM_CHECK(
+        std::ranges::all_of(values, [](const std::uint64_t value) { return value < size; }));
+    std::ranges::sort(values);
+    STORM_CHECK(std::ranges::adjacent_find(values) == values.end());
+
+    const Storm::lazy_permutation full{engine, ~std::uint64_t{0}};
+    STORM_CHECK(full[0] != full[1]);
+    STORM_CHECK(full[0] < ~std::uint64_t{0});
+}
+
+void test_first_position_is_uniform_across_keys() {
+    constexpr std::size_t size = 10;
+    constexpr std::size_t keys = 50'000;
+    constexpr double expected = static_cast<double>(keys) / static_cast<double>(size);
+    std::array<std::size_t, size> counts{};
+    Storm::engine_type engine{std::uint64_t{0xFE15'7E1}};
+    for (std::size_t key = 0; key < keys; ++key) {
+        const Storm::lazy_permutation permutation{engine, size};
+        ++counts[static_cast<std::size_t>(permutation[0])];
+    }
+    for (const std::size_t count : counts) {
+        STORM_CHECK(std::fabs(static_cast<double>(count) - expected) <= expected * 0.05);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_api_and_invalid_domain();
+    test_is_a_bijection();
+    test_keyed_by_engine();
+    test_large_domain_in_constant_memory();
+    test_first_position_is_uniform_across_keys();
+    return storm_test::finish();
+}
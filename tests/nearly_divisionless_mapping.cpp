@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr auto unsigned_max = std::numeric_limits<std::uint64_t>::max();
+
+// Schoolbook 128-bit product used as an independent Lemire reference.
+auto reference_product(const std::uint64_t left, const std::uint64_t right)
+    -> std::array<std::uint64_t, 2> {
+    std::array<std::uint64_t, 2> product{};
+    for (unsigned bit = 0; bit < 64U; ++bit) {
+        if (((right >> bit) & 1U) == 0U) {
+            continue;
+        }
+        const std::uint64_t shifted_low = bit == 0U ? left : left << bit;
+        const std::uint64_t shifted_high = bit == 0U ? 0U : left >> (64U - bit);
+        const std::uint64_t previous_low = product[0];
+        product[0] += shifted_low;
+        product[1] += shifted_high + (product[0] < previous_low ? 1U : 0U);
+    }
+    return product;
+}
+
+auto reference_nearly_divisionless(Storm::engine_type& engine, const std::uint64_t bound)
+    -> std::uint64_t {
+    if (bound == 0) {
+        return engine();
+    }
+    const std::uint64_t threshold = (std::uint64_t{0} - bound) % bound;
+    for (;;) {
+        const auto product = reference_product(engine(), bound);
+        if (product[0] >= threshold) {
+            return product[1];
+        }
+    }
+}
+
+void test_api() {
+    static_assert(Storm::bounded_mapping<Storm::modulo_mapping_t>);
+    static_assert(Storm::bounded_mapping<Storm::nearly_divisionless_mapping_t>);
+    static_assert(!Storm::bounded_mapping<int>);
+    static_assert(!std::is_convertible_v<int, Storm::nearly_divisionless_mapping_t>);
+    static_assert(std::is_same_v<decltype(Storm::uniform_index(
+                                     std::size_t{1}, Storm::nearly_divisionless_mapping)),
+                                 std::size_t>);
+    static_assert(!noexcept(Storm::uniform_index(std::size_t{1},
+                                                 Storm::nearly_divisionless_mapping)));
+
+    constexpr std::array<std::uint64_t, 6> left_operands{
+        0U, 1U, 6U, 0x8000'0000'0000'0001ULL, 0xDEAD'BEEF'CAFE'F00DULL, unsigned_max};
+    constexpr std::array<std::uint64_t, 6> right_operands{
+        1U, 7U, 0xFFFF'FFFFULL, 0x1'0000'0000ULL, 0x9E37'79B9'7F4A'7C15ULL, unsigned_max};
+    for (const std::uint64_t left : left_operands) {
+        for (const std::uint64_t right : right_operands) {
+            const auto expected = reference_product(left, right);
+            std::uint64_t wide_low = 0;
+            std::uint64_t portable_low = 0;
+            STORM_CHECK(Storm::detail::multiply_wide(left, right, wide_low) == expected[1]);
+            STORM_CHECK(wide_low == expected[0]);
+            STORM_CHECK(Storm::detail::multiply_wide_portable(left, right, portable_low) ==
+                        expected[1]);
+            STORM_CHECK(portable_low == expected[0]);
+        }
+    }
+}
+
+void test_reference_equivalence() {
+    constexpr std::array<std::uint64_t, 9> bounds{
+        1U, 2U, 6U, 7U, 1'000U, 1'024U, 0x8000'0000'0000'0000ULL,
+        0x8000'0000'0000'0001ULL, unsigned_max};
+    constexpr std::array<std::uint64_t, 3> seeds{0, 42, 0x11E1'1E15'0000'0002ULL};
+    for (const std::uint64_t seed : seeds) {
+        for (const std::uint64_t bound : bounds) {
+            Storm::engine_type actual_engine{seed};
+            Storm::engine_type reference_engine{seed};
+            for (std::size_t draw = 0; draw < 2'000; ++draw) {
+                STORM_CHECK(Storm::uniform_unsigned(actual_engine, std::uint64_t{0}, bound - 1U,
+                                                    Storm::nearly_divisionless_mapping) ==
+                            reference_nearly_divisionless(reference_engine, bound));
+                STORM_CHECK(actual_engine == reference_engine);
+            }
+        }
+        Storm::engine_type full_engine{seed};
+        Storm::engine_type raw_engine{seed};
+        STORM_CHECK(Storm::uniform_unsigned(full_engine, std::uint64_t{0}, unsigned_max,
+                                            Storm::nearly_divisionless_mapping) ==
+                    raw_engine());
+    }
+}
+
+void test_default_schedule_is_unchanged() {
+    Storm::engine_type tagged_engine{std::uint64_t{0}};
+    Storm::engine_type default_engine{std::uint64_t{0}};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(Storm::uniform_index(tagged_engine, std::size_t{7}, Storm::modulo_mapping) ==
+                    Storm::uniform_index(default_engine, std::size_t{7}));
+        STORM_CHECK(Storm::roll_die(tagged_engine, std::size_t{6}, Storm::modulo_mapping) ==
+                    Storm::roll_die(default_engine, std::size_t{6}));
+    }
+    STORM_CHECK(tagged_engine == default_engine);
+}
+
+void test_signed_range_and_dice_domains() {
+    Storm::engine_type engine{std::uint64_t{515}};
+    constexpr auto integer_min = std::numeric_limits<std::int64_t>::lowest();
+    constexpr auto integer_max = std::numeric_limits<std::int64_t>::max();
+    for (std::size_t draw = 0; draw < 2'048; ++draw) {
+        const auto integer = Storm::uniform_integer(engine, -5, 5,
+                                                    Storm::nearly_divisionless_mapping);
+        STORM_CHECK(integer >= -5 && integer <= 5);
+        const auto range = Storm::random_range(engine, 10, 1, -2,
+                                               Storm::nearly_divisionless_mapping);
+        STORM_CHECK(range <= 10 && range > 1 && (10 - range) % 2 == 0);
+        const auto wide = Storm::random_range(engine, integer_min, integer_max, integer_max,
+                                              Storm::nearly_divisionless_mapping);
+        STORM_CHECK(wide == integer_min || wide == -1 || wide == integer_max - 1);
+        const auto die = Storm::roll_die(engine, std::size_t{20},
+                                         Storm::nearly_divisionless_mapping);
+        STORM_CHECK(die >= 1U && die <= 20U);
+        const auto dice = Storm::roll_dice(engine, std::size_t{3}, std::size_t{6},
+                                           Storm::nearly_divisionless_mapping);
+        STORM_CHECK(dice >= 3U && dice <= 18U);
+    }
+    STORM_CHECK(Storm::uniform_integer(engine, integer_min, integer_min,
+                                       Storm::nearly_divisionless_mapping) == integer_min);
+
+    const Storm::engine_type before_invalid = engine;
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_index(engine, std::size_t{0},
+                                             Storm::nearly_divisionless_mapping));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::uniform_integer(engine, 1, -1,
+                                               Storm::nearly_divisionless_mapping));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::random_range(engine, 0, 10, 0,
+                                            Storm::nearly_divisionless_mapping));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::roll_die(engine, std::size_t{0},
+                                        Storm::nearly_divisionless_mapping));
+    STORM_EXPECT_THROWS(std::overflow_error,
+                        Storm::roll_dice(engine, std::numeric_limits<std::size_t>::max(),
+                                         std::size_t{2}, Storm::nearly_divisionless_mapping));
+    STORM_CHECK(engine == before_invalid);
+}
+
+void test_bulk_fill_matches_scalar_schedule() {
+    constexpr std::array<std::size_t, 5> sizes{1U, 6U, 1'000U, 1'024U,
+                                               std::numeric_limits<std::size_t>::max()};
+    for (const std::size_t size : sizes) {
+        Storm::engine_type bulk_engine{std::uint64_t{626}};
+        Storm::engine_type scalar_engine{std::uint64_t{626}};
+        std::vector<std::size_t> bulk(4'096);
+        Storm::uniform_index(bulk_engine, size, bulk, Storm::nearly_divisionless_mapping);
+        for (const std::size_t value : bulk) {
+            STORM_CHECK(value == Storm::uniform_index(scalar_engine, size,
+                                                      Storm::nearly_divisionless_mapping));
+        }
+        STORM_CHECK(bulk_engine == scalar_engine);
+    }
+
+    Storm::engine_type bulk_engine{std::uint64_t{727}};
+    Storm::engine_type scalar_engine{std::uint64_t{727}};
+    std::vector<std::int64_t> bulk(1'024);
+    Storm::random_range(bulk_engine, -9, 10, 3, bulk, Storm::nearly_divisionless_mapping);
+    for (const std::int64_t value : bulk) {
+        STORM_CHECK(value == Storm::random_range(scalar_engine, -9, 10, 3,
+                                                 Storm::nearly_divisionless_mapping));
+    }
+    STORM_CHECK(bulk_engine == scalar_engine);
+}
+
+void test_frequencies() {
+    constexpr std::size_t bucket_count = 6;
+    constexpr std::size_t samples = 60'000;
+    constexpr double expected = static_cast<double>(samples) / static_cast<double>(bucket_count);
+    constexpr double tolerance = expected * 0.05;
+    std::array<std::size_t, bucket_count> buckets{};
+    Storm::engine_type engine{std::uint64_t{1'357'913}};
+    for (std::size_t index = 0; index < samples; ++index) {
+        ++buckets[Storm::uniform_index(engine, bucket_count, Storm::nearly_divisionless_mapping)];
+    }
+    for (const std::size_t count : buckets) {
+        STORM_CHECK(std::fabs(static_cast<double>(count) - expected) <= tolerance);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_api();
+    test_reference_equivalence();
+    test_default_schedule_is_unchanged();
+    test_signed_range_and_dice_domains();
+    test_bulk_fill_matches_scalar_schedule();
+    test_frequencies();
+    return storm_test::finish();
+}
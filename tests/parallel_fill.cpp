@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t seed = 0x5EED'0000'0000'0016ULL;
+constexpr std::size_t block = Storm::detail::parallel_fill_block;
+constexpr std::size_t length = (3 * block) + 123;
+
+auto fill_canonical(const std::size_t size, const std::size_t threads) -> std::vector<double> {
+    std::vector<double> values(size);
+    Storm::parallel_fill_canonical(seed, std::span<double>{values}, threads);
+    return values;
+}
+
+auto fill_index(const std::size_t size, const std::size_t threads)
+    -> std::vector<std::size_t> {
+    std::vector<std::size_t> values(length);
+    Storm::parallel_fill_index(seed, size, std::span<std::size_t>{values}, threads);
+    return values;
+}
+
+void test_canonical_thread_count_invariance() {
+    const auto expected = fill_canonical(length, 1);
+    for (const std::size_t threads : {std::size_t{0}, std::size_t{2}, std::size_t{3},
+                                      std::size_t{4}, std::size_t{16}}) {
+        STORM_CHECK(fill_canonical(length, threads) == expected);
+    }
+    for (const double value : expected) {
+        STORM_CHECK(value >= 0.0 && value < 1.0);
+    }
+}
+
+void test_canonical_block_streams() {
+    const auto values = fill_canonical(length, 3);
+    for (const std::size_t index : {std::size_t{0}, std::size_t{2}, std::size_t{3}}) {
+        Storm::philox4x64 engine{seed, index};
+        const std::size_t first = index * block;
+        bool same = true;
+        for (std::size_t offset = 0; first + offset < length && offset < block; ++offset) {
+            same = Storm::canonical(engine) == values[first + offset] && same;
+        }
+        STORM_CHECK(same);
+    }
+    const auto shorter = fill_canonical(block + 7, 2);
+    STORM_CHECK(std::equal(shorter.begin(), shorter.end(), values.begin()));
+}
+
+void test_index_thread_count_invariance() {
+    for (const std::size_t size : {std::size_t{1}, std::size_t{6}, std::size_t{1'000'003}}) {
+        const auto expected = fill_index(size, 1);
+        STORM_CHECK(fill_index(size, 2) == expected);
+        STORM_CHECK(fill_index(size, 5) == expected);
+        bool in_range = true;
+        for (const std::size_t value : expected) {
+            in_range = value < size && in_range;
+        }
+        STORM_CHECK(in_range);
+    }
+
+    std::vector<std::size_t> first_block(block);
+    Storm::philox4x64 engine{seed, 0};
+    Storm::uniform_index(engine, std::size_t{6}, std::span<std::size_t>{first_block});
+    const auto values = fill_index(6, 4);
+    STORM_CHECK(std::equal(first_block.begin(), first_block.end(), values.begin()));
+}
+
+void test_contracts() {
+    std::vector<std::size_t> indices(10);
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::parallel_fill_index(seed, 0, std::span<std::size_t>{indices}));
+    Storm::parallel_fill_canonical(seed, std::span<double>{});
+    Storm::parallel_fill_index(seed, 10, std::span<std::size_t>{});
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_canonical_thread_count_invariance();
+    test_canonical_block_streams();
+    test_index_thread_count_invariance();
+    test_contracts();
+    return storm_test::finish();
+}
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+auto iota_vector(const std::size_t size) -> std::vector<std::uint32_t> {
+    std::vector<std::uint32_t> values(size);
+    std::iota(values.begin(), values.end(), std::uint32_t{0});
+    return values;
+}
+
+auto shuffled(const std::uint64_t seed,
+              const std::size_t size,
+              const std::size_t threads,
+              const std::size_t block_size,
+              const std::size_t bucket_size) -> std::vector<std::uint32_t> {
+    auto values = iota_vector(size);
+    Storm::detail::parallel_shuffle(
+        seed, std::span{values}, threads, block_size, bucket_size);
+    return values;
+}
+
+void test_thread_count_invariance() {
+    for (const std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{1'000},
+                                   std::size_t{100'003}}) {
+        const auto expected = shuffled(11, size, 1, 4'096, 1'024);
+        auto sorted = expected;
+        std::ranges::sort(sorted);
+        STORM_CHECK(sorted == iota_vector(size));
+        for (const std::size_t threads : {std::size_t{2}, std::size_t{3}, std::size_t{8}}) {
+            STORM_CHECK(shuffled(11, size, threads, 4'096, 1'024) == expected);
+        }
+        STORM_CHECK(size < 2 || shuffled(12, size, 1, 4'096, 1'024) != expected);
+    }
+}
+
+void test_public_overload() {
+    const std::size_t size = (3 * Storm::detail::parallel_shuffle_block) + 17;
+    auto first = iota_vector(size);
+    auto second = iota_vector(size);
+    Storm::parallel_shuffle(2026, first, 1);
+    Storm::parallel_shuffle(2026, second, 4);
+    STORM_CHECK(first == second);
+    STORM_CHECK(first != iota_vector(size));
+    std::ranges::sort(first);
+    STORM_CHECK(first == iota_vector(size));
+
+    std::vector<std::string> words{"a", "b", "c", "d"};
+    Storm::parallel_shuffle(5, words);
+    std::ranges::sort(words);
+    STORM_CHECK((words == std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+void test_one_bucket_is_the_batched_shuffle() {
+    const std::size_t size = Storm::detail::parallel_shuffle_bucket;
+    auto parallel = iota_vector(size);
+    auto serial = iota_vector(size);
+    Storm::parallel_shuffle(77, parallel);
+    Storm::philox4x64 engine{77, Storm::detail::parallel_shuffle_bucket_stream};
+    Storm::shuffle(engine, serial, Storm::nearly_divisionless_mapping);
+    STORM_CHECK(parallel == serial);
+}
+
+// Six values in blocks of four and buckets of two exercise counting,
+// scattering across blocks, and local shuffles; every order should be
+// equally likely.
+void test_uniform_over_permutations() {
+    constexpr std::size_t size = 6;
+    constexpr std::size_t orders = 720;
+    constexpr std::size_t trials = 144'000;
+    std::vector<std::size_t> counts(orders);
+    for (std::size_t trial = 0; trial < trials; ++trial) {
+        const auto values = shuffled(trial, size, 1, 4, 2);
+        std::size_t rank = 0;
+        for (std::size_t position = 0; position < size; ++position) {
+            const auto smaller_after = static_cast<std::size_t>(std::count_if(
+                values.begin() + static_cast<std::ptrdiff_t>(position) + 1,
+                values.end(),
+                [&values, position](const std::uint32_t value) {
+                    return value < values[position];
+                }));
+            rank = (rank * (size - position)) + smaller_after;
+        }
+        ++counts[rank];
+    }
+    constexpr double expected = static_cast<double>(trials) / orders;
+    double chi_square = 0.0;
+    for (const std::size_t count : counts) {
+        const double difference = static_cast<double>(count) - expected;
+        chi_square += difference * difference / expected;
+    }
+    // 719 degrees of freedom; the 1e-6 upper tail is near 920.
+    STORM_CHECK(chi_square < 920.0);
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_thread_count_invariance();
+    test_public_overload();
+    test_one_bucket_is_the_batched_shuffle();
+    test_uniform_over_permutations();
+    return storm_test::finish();
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+namespace {
+
+using counter_type = Storm::philox4x64::counter_type;
+using key_type = Storm::philox4x64::key_type;
+
+struct known_answer {
+    counter_type counter;
+    key_type key;
+    counter_type expected;
+};
+
+// Philox4x64-10 vectors from kat_vectors in the Random123 distribution.
+constexpr std::array<known_answer, 3> known_answers{{
+    {{0, 0, 0, 0},
+     {0, 0},
+     {0x1655'4D9E'CA36'314CULL, 0xDB20'FE9D'672D'0FDCULL, 0xD7E7'72CE'E186'176BULL,
+      0x7E68'B68A'EC7B'A23BULL}},
+    {{~0ULL, ~0ULL, ~0ULL, ~0ULL},
+     {~0ULL, ~0ULL},
+     {0x87B0'92C3'013F'E90BULL, 0x438C'3C67'BE8D'0224ULL, 0x9CC7'D7C6'9CD7'77B6ULL,
+      0xA09C'AEBF'594F'0BA0ULL}},
+    {{0x243F'6A88'85A3'08D3ULL, 0x1319'8A2E'0370'7344ULL, 0xA409'3822'299F'31D0ULL,
+      0x082E'FA98'EC4E'6C89ULL},
+     {0x4528'21E6'38D0'1377ULL, 0xBE54'66CF'34E9'0C6CULL},
+     {0xA528'F454'03E6'1D95ULL, 0x38C7'2DBD'566E'9788ULL, 0xA5A1'610E'72FD'18B5ULL,
+      0x57BD'43B5'E52B'7FE6ULL}},
+}};
+
+void test_known_answers() {
+    static_assert(Storm::philox4x64::generate(known_answers[0].counter, known_answers[0].key) ==
+                  known_answers[0].expected);
+    for (const known_answer& answer : known_answers) {
+        STORM_CHECK(Storm::philox4x64::generate(answer.counter, answer.key) == answer.expected);
+    }
+}
+
+void test_engine_requirements() {
+    static_assert(Storm::random_engine<Storm::philox4x64>);
+    static_assert(std::is_same_v<Storm::CounterGenerator::engine_type, Storm::philox4x64>);
+
+    Storm::philox4x64 engine{0x4528'21E6'38D0'1377ULL, 0xBE54'66CF'34E9'0C6CULL};
+    STORM_CHECK(engine.stream() == 0xBE54'66CF'34E9'0C6CULL);
+    for (std::uint64_t block = 0; block < 100; ++block) {
+        const counter_type expected = Storm::philox4x64::generate(
+            {block, 0, 0, 0}, {0x4528'21E6'38D0'1377ULL, 0xBE54'66CF'34E9'0C6CULL});
+        for (const std::uint64_t word : expected) {
+            STORM_CHECK(engine() == word);
+        }
+    }
+
+    Storm::philox4x64 first{5, 1};
+    Storm::philox4x64 second{5, 2};
+    STORM_CHECK(!(first == second));
+    STORM_CHECK(first() != second());
+    second.seed(6);
+    STORM_CHECK(second.stream() == 2U);
+    STORM_CHECK(second == (Storm::philox4x64{6, 2}));
+    STORM_CHECK(Storm::philox4x64{} == (Storm::philox4x64{0, 0}));
+
+    std::seed_seq sequence{1U, 2U};
+    std::seed_seq same_sequence{1U, 2U};
+    Storm::philox4x64 sequenced{sequence};
+    Storm::philox4x64 reseeded{9, 9};
+    reseeded.seed(same_sequence);
+    STORM_CHECK(sequenced == reseeded);
+}
+
+void test_seek_and_discard_match_sequential() {
+    Storm::philox4x64 sequential{77, 3};
+    std::array<std::uint64_t, 64> values{};
+    for (std::uint64_t& value : values) {
+        value = sequential();
+    }
+    for (std::uint64_t position = 0; position < values.size(); ++position) {
+        Storm::philox4x64 sought{77, 3};
+        static_cast<void>(sought());
+        sought.seek(position);
+        STORM_CHECK(sought() == values[position]);
+
+        for (std::uint64_t start = 0; start <= position; ++start) {
+            Storm::philox4x64 discarded{77, 3};
+            discarded.seek(start);
+            discarded.discard(position - start);
+            STORM_CHECK(discarded() == values[position]);
+        }
+    }
+
+    Storm::philox4x64 skipped{77, 3};
+    skipped.seek(999'999);
+    const counter_type block = Storm::philox4x64::generate({999'999 / 4, 0, 0, 0}, {77, 3});
+    STORM_CHECK(skipped() == block[999'999 % 4]);
+    STORM_CHECK(skipped() == Storm::philox4x64::generate({250'000, 0, 0, 0}, {77, 3})[0]);
+}
+
+void test_discard_carries_into_high_counter_words() {
+    Storm::philox4x64 engine{1, 1};
+    engine.seek(6);
+    for (std::size_t repeat = 0; repeat < 4; ++repeat) {
+        engine.discard(~0ULL);
+    }
+    // 6 + 4 * (2^64 - 1) outputs is block 2^64 + 0, lane 2.
+    const counter_type expected = Storm::philox4x64::generate({0, 1, 0, 0}, {1, 1});
+    STORM_CHECK(engine() == expected[2]);
+    STORM_CHECK(engine() == expected[3]);
+    STORM_CHECK(engine() == Storm::philox4x64::generate({1, 1, 0, 0}, {1, 1})[0]);
+}
+
+void test_algorithms_accept_counter_engine() {
+    Storm::CounterGenerator generator{2'026};
+    Storm::philox4x64 replay{2'026};
+    replay.seek(0);
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(Storm::uniform_index(generator.engine(), std::size_t{1'000}) ==
+                    Storm::uniform_index(replay, std::size_t{1'000}));
+    }
+    STORM_CHECK(generator.engine() == replay);
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_known_answers();
+    test_engine_requirements();
+    test_seek_and_discard_match_sequential();
+    test_discard_carries_into_high_counter_words();
+    test_algorithms_accept_counter_engine();
+    return storm_test::finish();
+}
@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+void test_validation_and_construction_engine_state() {
+    Storm::seed(std::uint64_t{901});
+    const Storm::engine_type initial_thread_state = Storm::thread_engine();
+    const Storm::PreparedAliasWeightedIndex integer_weights{std::array{1, 2, 3}};
+    STORM_CHECK(Storm::thread_engine() == initial_thread_state);
+    STORM_CHECK(integer_weights.size() == 3U);
+
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedAliasWeightedIndex(std::initializer_list<double>{}));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedAliasWeightedIndex({0.0, 0.0, 0.0}));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedAliasWeightedIndex({1.0, -1.0}));
+    STORM_EXPECT_THROWS(
+        std::invalid_argument,
+        Storm::PreparedAliasWeightedIndex({1.0, std::numeric_limits<double>::quiet_NaN()}));
+    STORM_EXPECT_THROWS(
+        std::invalid_argument,
+        Storm::PreparedAliasWeightedIndex({1.0, std::numeric_limits<double>::infinity()}));
+    STORM_EXPECT_THROWS(
+        std::overflow_error,
+        Storm::PreparedAliasWeightedIndex(
+            {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()}));
+    STORM_CHECK(Storm::thread_engine() == initial_thread_state);
+
+    static_assert(!noexcept(Storm::PreparedAliasWeightedIndex({1.0})));
+    static_assert(noexcept(std::declval<const Storm::PreparedAliasWeightedIndex&>()(
+        std::declval<Storm::engine_type&>())));
+    static_assert(std::is_same_v<decltype(std::declval<const Storm::PreparedAliasWeightedIndex&>()(
+                                     std::declval<Storm::engine_type&>())),
+                                 std::size_t>);
+}
+
+void test_alias_table_preserves_probabilities() {
+    const std::array<std::vector<double>, 7> tables{
+        std::vector<double>{1.0},
+        std::vector<double>{1.0, 1.0, 1.0, 1.0},
+        std::vector<double>{1.0, 3.0, 2.0, 8.0},
+        std::vector<double>{0.0, 1.0, 0.0, 7.0, 0.0, 2.0, 0.0},
+        std::vector<double>{1e-300, 1e300, 1.0},
+        std::vector<double>{std::numeric_limits<double>::denorm_min(), 0.0},
+        std::vector<double>(1'000, 1.0),
+    };
+    constexpr double two_to_64 = 0x1.0p64;
+    for (const auto& weights : tables) {
+        double total = 0.0;
+        for (const double weight : weights) {
+            total += weight;
+        }
+        const auto table = Storm::detail::make_alias_table(weights, total);
+        STORM_CHECK(table.size() == weights.size());
+        std::vector<double> mass(weights.size());
+        for (std::size_t column = 0; column < table.size(); ++column) {
+            const double kept = static_cast<double>(table[column].threshold) / two_to_64;
+            STORM_CHECK(table[column].alias < table.size());
+            mass[column] += kept;
+            mass[table[column].alias] += 1.0 - kept;
+        }
+        for (std::size_t index = 0; index < weights.size(); ++index) {
+            const double expected =
+                weights[index] / total * static_cast<double>(weights.size());
+            STORM_CHECK(storm_test::approximately(mass[index], expected, 1e-9));
+            if (weights[index] == 0.0) {
+                STORM_CHECK(table[index].threshold == 0U);
+                STORM_CHECK(weights[table[index].alias] > 0.0);
+            }
+        }
+    }
+}
+
+void test_engine_schedule() {
+    const Storm::PreparedAliasWeightedIndex prepared{{1.0, 3.0, 0.0, 6.0, 2.0}};
+    Storm::engine_type actual_engine{std::uint64_t{31}};
+    Storm::engine_type reference_engine{std::uint64_t{31}};
+    for (std::size_t draw = 0; draw < 10'000; ++draw) {
+        const std::size_t selected = prepared(actual_engine);
+        static_cast<void>(Storm::uniform_index(reference_engine, std::size_t{5}));
+        static_cast<void>(reference_engine());
+        STORM_CHECK(selected < 5U);
+        STORM_CHECK(actual_engine == reference_engine);
+    }
+}
+
+void test_zero_weights_are_never_selected() {
+    const Storm::PreparedAliasWeightedIndex prepared{{0.0, 1.0, 0.0, 4.0, 0.0}};
+    Storm::engine_type engine{std::uint64_t{808}};
+    for (std::size_t draw = 0; draw < 100'000; ++draw) {
+        const std::size_t selected = prepared(engine);
+        STORM_CHECK(selected == 1U || selected == 3U);
+    }
+}
+
+void test_frequencies() {
+    constexpr std::size_t samples = 200'000;
+    constexpr std::array<double, 5> weights{1.0, 3.0, 0.0, 6.0, 10.0};
+    constexpr double tolerance = 0.01;
+    const Storm::PreparedAliasWeightedIndex prepared{weights};
+    std::array<std::size_t, weights.size()> buckets{};
+    Storm::engine_type engine{std::uint64_t{9'876'543}};
+    for (std::size_t draw = 0; draw < samples; ++draw) {
+        ++buckets[prepared(engine)];
+    }
+    for (std::size_t index = 0; index < buckets.size(); ++index) {
+        const double actual =
+            static_cast<double>(buckets[index]) / static_cast<double>(samples);
+        STORM_CHECK(std::fabs(actual - weights[index] / 20.0) <= tolerance);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_validation_and_construction_engine_state();
+    test_alias_table_preserves_probabilities();
+    test_engine_schedule();
+    test_zero_weights_are_never_selected();
+    test_frequencies();
+    return storm_test::finish();
+}
@@ -3,12 +3,15 @@
 
 #include "test_harness.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
 #include <limits>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -126,6 +129,236 @@ void test_duplicate_boundaries_are_never_selected() {
     }
 }
 
+void test_eytzinger_search_matches_upper_bound() {
+    Storm::engine_type engine{std::uint64_t{0xE172'2026}};
+    for (std::size_t size = 1; size <= 130; ++size) {
+        std::vector<double> boundaries;
+        boundaries.reserve(size);
+        double boundary = 0.0;
+        for (std::size_t index = 0; index < size; ++index) {
+            if (Storm::uniform_index(engine, std::size_t{3}) != 0U) {
+                boundary += static_cast<double>(Storm::uniform_index(engine, std::size_t{4}));
+            }
+            boundaries.push_back(boundary);
+        }
+        const Storm::detail::eytzinger_index eytzinger{boundaries};
+        std::vector<double> queries{-1.0, 0.0, boundary, boundary + 1.0};
+        for (const double value : boundaries) {
+            queries.push_back(value);
+            queries.push_back(std::nextafter(value, -1.0));
+            queries.push_back(value + 0.5);
+        }
+        for (const double query : queries) {
+            const auto expected = static_cast<std::size_t>(
+                std::ranges::upper_bound(boundaries, query) - boundaries.begin());
+            STORM_CHECK(eytzinger.upper_bound(query) == expected);
+        }
+    }
+}
+
+void test_layouts_select_identically() {
+    const std::array<std::vector<double>, 5> tables{
+        std::vector<double>{1.0},
+        std::vector<double>{std::numeric_limits<double>::denorm_min()},
+        std::vector<double>{0.0, 1.0, 1.0, 5.0, 5.0},
+        std::vector<double>{0.0, 0.0, 2.0, 2.0, 2.0, 7.0, 9.0, 9.0},
+        std::vector<double>(1'000, 3.0),
+    };
+    std::vector<double> ramp(4'099);
+    for (std::size_t index = 0; index < ramp.size(); ++index) {
+        ramp[index] = static_cast<double>(index / 3U);
+    }
+    constexpr std::array<std::uint64_t, 3> seeds{0, 42, 0xCAFE'F00D'1234'5678ULL};
+
+    auto check_table = [&seeds](const std::vector<double>& cumulative) {
+        if (cumulative.back() == 0.0) {
+            return;
+        }
+        const Storm::PreparedCumulativeWeightedIndex sorted{cumulative};
+        const Storm::PreparedCumulativeWeightedIndex eytzinger{
+            cumulative, Storm::cumulative_layout::eytzinger};
+        for (const std::uint64_t seed : seeds) {
+            Storm::engine_type sorted_engine{seed};
+            Storm::engine_type eytzinger_engine{seed};
+            for (std::size_t draw = 0; draw < 10'000; ++draw) {
+                STORM_CHECK(sorted(sorted_engine) == eytzinger(eytzinger_engine));
+                STORM_CHECK(sorted_engine == eytzinger_engine);
+            }
+        }
+    };
+    for (const auto& cumulative : tables) {
+        check_table(cumulative);
+    }
+    check_table(ramp);
+
+    const Storm::PreparedCumulativeWeightedIndex initializer{
+        {0.0, 1.0, 1.0, 4.0}, Storm::cumulative_layout::eytzinger};
+    Storm::engine_type engine{std::uint64_t{5}};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        const std::size_t selected = initializer(engine);
+        STORM_CHECK(selected == 1U || selected == 3U);
+    }
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedCumulativeWeightedIndex(
+                            {1.0, 0.5}, Storm::cumulative_layout::eytzinger));
+}
+
+void test_guide_search_matches_upper_bound() {
+    Storm::engine_type engine{std::uint64_t{0x6017'DE00}};
+    for (std::size_t size = 1; size <= 130; ++size) {
+        std::vector<double> boundaries;
+        boundaries.reserve(size);
+        double boundary = 0.0;
+        for (std::size_t index = 0; index < size; ++index) {
+            if (Storm::uniform_index(engine, std::size_t{3}) != 0U) {
+                boundary += static_cast<double>(Storm::uniform_index(engine, std::size_t{4}));
+            }
+            boundaries.push_back(boundary);
+        }
+        if (boundary == 0.0) {
+            continue;
+        }
+        std::vector<double> queries{0.0, boundary, boundary + 1.0};
+        for (const double value : boundaries) {
+            queries.push_back(value);
+            queries.push_back(std::nextafter(value, boundary + 1.0));
+            if (value > 0.0) {
+                queries.push_back(std::nextafter(value, 0.0));
+            }
+        }
+        for (const std::size_t cutpoints : {std::size_t{1}, std::size_t{2}, size, 4 * size,
+                                            std::size_t{1'000}}) {
+            const Storm::detail::guide_index guide{boundaries, boundary, cutpoints};
+            STORM_CHECK(!guide.empty());
+            for (const double query : queries) {
+                const auto expected = static_cast<std::size_t>(
+                    std::ranges::upper_bound(boundaries, query) - boundaries.begin());
+                STORM_CHECK(guide.upper_bound(boundaries, query) == expected);
+            }
+        }
+    }
+
+    const std::vector<double> subnormal{std::numeric_limits<double>::denorm_min()};
+    const Storm::detail::guide_index unscalable{
+        subnormal, std::numeric_limits<double>::denorm_min(), 1'000};
+    STORM_CHECK(unscalable.empty());
+}
+
+void test_guided_selection_matches_sorted() {
+    std::vector<double> ramp(4'099);
+    for (std::size_t index = 0; index < ramp.size(); ++index) {
+        ramp[index] = static_cast<double>(index / 3U);
+    }
+    const std::array<std::vector<double>, 4> tables{
+        std::vector<double>{std::numeric_limits<double>::denorm_min()},
+        std::vector<double>{0.0, 1.0, 1.0, 5.0, 5.0},
+        std::vector<double>{0.0, 0.0, 2.0, 2.0, 2.0, 7.0, 9.0, 9.0},
+        ramp,
+    };
+    constexpr std::array<std::uint64_t, 3> seeds{0, 42, 0xCAFE'F00D'1234'5678ULL};
+
+    for (const auto& cumulative : tables) {
+        const Storm::PreparedCumulativeWeightedIndex sorted{cumulative};
+        for (const std::size_t cutpoints :
+             {std::size_t{1}, cumulative.size(), 8 * cumulative.size()}) {
+            const Storm::PreparedCumulativeWeightedIndex guided{
+                cumulative, Storm::guide_table{cutpoints}};
+            for (const std::uint64_t seed : seeds) {
+                Storm::engine_type sorted_engine{seed};
+                Storm::engine_type guided_engine{seed};
+                for (std::size_t draw = 0; draw < 10'000; ++draw) {
+                    STORM_CHECK(sorted(sorted_engine) == guided(guided_engine));
+                    STORM_CHECK(sorted_engine == guided_engine);
+                }
+            }
+        }
+    }
+
+    const Storm::PreparedCumulativeWeightedIndex initializer{{0.0, 1.0, 1.0, 4.0},
+                                                             Storm::guide_table{16}};
+    Storm::engine_type engine{std::uint64_t{5}};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        const std::size_t selected = initializer(engine);
+        STORM_CHECK(selected == 1U || selected == 3U);
+    }
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedCumulativeWeightedIndex({1.0, 2.0},
+                                                               Storm::guide_table{0}));
+    STORM_EXPECT_THROWS(
+        std::length_error,
+        Storm::PreparedCumulativeWeightedIndex(
+            {1.0, 2.0}, Storm::guide_table{std::numeric_limits<std::size_t>::max()}));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedCumulativeWeightedIndex({1.0, 0.5},
+                                                               Storm::guide_table{4}));
+}
+
+void test_interleaved_search_matches_upper_bound() {
+    Storm::engine_type engine{std::uint64_t{0x1A7E'0008}};
+    for (std::size_t size = 1; size <= 130; ++size) {
+        std::vector<double> boundaries;
+        boundaries.reserve(size);
+        double boundary = 0.0;
+        for (std::size_t index = 0; index < size; ++index) {
+            if (Storm::uniform_index(engine, std::size_t{3}) != 0U) {
+                boundary += static_cast<double>(Storm::uniform_index(engine, std::size_t{4}));
+            }
+            boundaries.push_back(boundary);
+        }
+        std::vector<double> queries{-1.0, 0.0, boundary, boundary + 1.0};
+        for (const double value : boundaries) {
+            queries.push_back(value);
+            queries.push_back(std::nextafter(value, -1.0));
+            queries.push_back(value + 0.5);
+        }
+        for (std::size_t offset = 0; offset < queries.size();
+             offset += Storm::detail::selection_batch) {
+            const std::size_t count =
+                std::min(Storm::detail::selection_batch, queries.size() - offset);
+            const std::span<const double> values{queries.data() + offset, count};
+            std::vector<std::size_t> actual(count);
+            Storm::detail::upper_bound_interleaved(boundaries, values, actual);
+            for (std::size_t lane = 0; lane < count; ++lane) {
+                const auto expected = static_cast<std::size_t>(
+                    std::ranges::upper_bound(boundaries, values[lane]) - boundaries.begin());
+                STORM_CHECK(actual[lane] == expected);
+            }
+        }
+    }
+}
+
+void test_select_many_matches_scalar_schedule() {
+    std::vector<double> ramp(4'099);
+    for (std::size_t index = 0; index < ramp.size(); ++index) {
+        ramp[index] = static_cast<double>(index / 3U);
+    }
+    const std::array<std::vector<double>, 3> tables{
+        std::vector<double>{std::numeric_limits<double>::denorm_min()},
+        std::vector<double>{0.0, 0.0, 2.0, 2.0, 2.0, 7.0, 9.0, 9.0},
+        ramp,
+    };
+    for (const auto& cumulative : tables) {
+        const std::array<Storm::PreparedCumulativeWeightedIndex, 3> selectors{
+            Storm::PreparedCumulativeWeightedIndex{cumulative},
+            Storm::PreparedCumulativeWeightedIndex{cumulative,
+                                                   Storm::cumulative_layout::eytzinger},
+            Storm::PreparedCumulativeWeightedIndex{cumulative, Storm::guide_table{64}},
+        };
+        for (const auto& prepared : selectors) {
+            Storm::engine_type scalar_engine{std::uint64_t{99}};
+            Storm::engine_type bulk_engine{std::uint64_t{99}};
+            std::vector<std::size_t> expected(1'027);
+            for (std::size_t& value : expected) {
+                value = prepared(scalar_engine);
+            }
+            std::vector<std::size_t> actual(expected.size());
+            prepared.select_many(bulk_engine, std::span<std::size_t>{actual});
+            STORM_CHECK(actual == expected);
+            STORM_CHECK(bulk_engine == scalar_engine);
+        }
+    }
+}
+
 }  // namespace
 
 auto main() -> int {
@@ -134,5 +367,11 @@ auto main() -> int {
     test_supplied_strict_boundary_is_preserved();
     test_subnormal_endpoint_correction();
     test_duplicate_boundaries_are_never_selected();
+    test_eytzinger_search_matches_upper_bound();
+    test_layouts_select_identically();
+    test_guide_search_matches_upper_bound();
+    test_guided_selection_matches_sorted();
+    test_interleaved_search_matches_upper_bound();
+    test_select_many_matches_scalar_schedule();
     return storm_test::finish();
 }
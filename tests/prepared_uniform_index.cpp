@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+namespace {
+
+constexpr auto size_max = std::numeric_limits<std::size_t>::max();
+
+void test_api_and_validation() {
+    static_assert(!std::is_convertible_v<std::size_t, Storm::PreparedUniformIndex>);
+    static_assert(std::is_same_v<decltype(std::declval<const Storm::PreparedUniformIndex&>()(
+                                     std::declval<Storm::engine_type&>())),
+                                 std::size_t>);
+    static_assert(noexcept(std::declval<const Storm::PreparedUniformIndex&>()(
+        std::declval<Storm::engine_type&>())));
+    static_assert(!noexcept(Storm::PreparedUniformIndex{std::size_t{1}}));
+    static_assert(Storm::detail::fixed_remainder{7}(std::uint64_t{100}) == 2U);
+    static_assert(Storm::detail::fixed_remainder{1}(std::uint64_t{100}) == 0U);
+
+    STORM_EXPECT_THROWS(std::invalid_argument, Storm::PreparedUniformIndex{std::size_t{0}});
+    const Storm::PreparedUniformIndex prepared{std::size_t{17}};
+    STORM_CHECK(prepared.size() == 17U);
+}
+
+void test_fixed_remainder_matches_modulo() {
+    constexpr std::array<std::uint64_t, 12> divisors{
+        1U, 2U, 3U, 6U, 7U, 1'000U, 1'024U, 0xFFFF'FFFFULL, 0x1'0000'0001ULL,
+        0x8000'0000'0000'0000ULL, 0x8000'0000'0000'0001ULL,
+        std::numeric_limits<std::uint64_t>::max()};
+    constexpr std::array<std::uint64_t, 6> edges{
+        0U, 1U, 0x7FFF'FFFF'FFFF'FFFFULL, 0x8000'0000'0000'0000ULL,
+        std::numeric_limits<std::uint64_t>::max() - 1U,
+        std::numeric_limits<std::uint64_t>::max()};
+    Storm::engine_type engine{std::uint64_t{0xF457'0D00}};
+    for (const std::uint64_t divisor : divisors) {
+        const Storm::detail::fixed_remainder remainder{divisor};
+        for (const std::uint64_t value : edges) {
+            STORM_CHECK(remainder(value) == value % divisor);
+            STORM_CHECK(remainder(value - value % divisor) == 0U);
+        }
+        for (std::size_t draw = 0; draw < 20'000; ++draw) {
+            const auto value = static_cast<std::uint64_t>(engine());
+            STORM_CHECK(remainder(value) == value % divisor);
+        }
+    }
+    for (std::size_t draw = 0; draw < 2'000; ++draw) {
+        const auto shift = static_cast<unsigned>(draw % 64U);
+        const std::uint64_t divisor = (static_cast<std::uint64_t>(engine()) >> shift) | 1U;
+        const Storm::detail::fixed_remainder remainder{divisor};
+        for (std::size_t value_draw = 0; value_draw < 64; ++value_draw) {
+            const auto value = static_cast<std::uint64_t>(engine());
+            STORM_CHECK(remainder(value) == value % divisor);
+        }
+    }
+}
+
+void test_uniform_index_identity() {
+    constexpr std::array<std::size_t, 11> sizes{
+        1U, 2U, 6U, 7U, 17U, 1'000U, 1'024U,
+        static_cast<std::size_t>(0xFFFF'FFFFULL), size_max / 2U + 1U, size_max / 2U + 2U,
+        size_max};
+    constexpr std::array<std::uint64_t, 4> seeds{0, 1, 42, 0xCAFE'F00D'1234'5678ULL};
+    for (const std::size_t size : sizes) {
+        const Storm::PreparedUniformIndex prepared{size};
+        for (const std::uint64_t seed : seeds) {
+            Storm::engine_type prepared_engine{seed};
+            Storm::engine_type scalar_engine{seed};
+            for (std::size_t draw = 0; draw < 5'000; ++draw) {
+                STORM_CHECK(prepared(prepared_engine) ==
+                            Storm::uniform_index(scalar_engine, size));
+                STORM_CHECK(prepared_engine == scalar_engine);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_api_and_validation();
+    test_fixed_remainder_matches_modulo();
+    test_uniform_index_identity();
+    return storm_test::finish();
+}
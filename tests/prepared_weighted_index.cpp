@@ -11,6 +11,7 @@
 #include <initializer_list>
 #include <limits>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -142,6 +143,80 @@ void test_reference_equivalence() {
     }
 }
 
+void test_search_layout_equivalence() {
+    std::vector<double> large(100'000);
+    for (std::size_t index = 0; index < large.size(); ++index) {
+        large[index] = index % 11U == 0U ? 0.0 : static_cast<double>((index % 7U) + 1U);
+    }
+    const std::array<std::vector<double>, 4> tables{
+        std::vector<double>{1.0},
+        std::vector<double>{0.0, 1.0, 0.0, 7.0, 0.0, 2.0, 0.0},
+        std::vector<double>{std::numeric_limits<double>::denorm_min(), 0.0, 0.0},
+        large,
+    };
+    for (const auto& weights : tables) {
+        const Storm::PreparedWeightedIndex sorted{weights};
+        const Storm::PreparedWeightedIndex eytzinger{weights,
+                                                     Storm::cumulative_layout::eytzinger};
+        const Storm::PreparedWeightedIndex guided{weights, Storm::guide_table{weights.size()}};
+        Storm::engine_type sorted_engine{std::uint64_t{2'718}};
+        Storm::engine_type eytzinger_engine{std::uint64_t{2'718}};
+        Storm::engine_type guided_engine{std::uint64_t{2'718}};
+        for (std::size_t draw = 0; draw < 20'000; ++draw) {
+            const std::size_t expected = sorted(sorted_engine);
+            STORM_CHECK(eytzinger(eytzinger_engine) == expected);
+            STORM_CHECK(guided(guided_engine) == expected);
+            STORM_CHECK(sorted_engine == eytzinger_engine);
+            STORM_CHECK(sorted_engine == guided_engine);
+        }
+    }
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedWeightedIndex({0.0, 0.0},
+                                                     Storm::cumulative_layout::eytzinger));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::PreparedWeightedIndex({1.0, 2.0}, Storm::guide_table{0}));
+    STORM_EXPECT_THROWS(
+        std::length_error,
+        Storm::PreparedWeightedIndex(
+            {1.0, 2.0, 3.0}, Storm::guide_table{std::numeric_limits<std::size_t>::max()}));
+}
+
+void test_select_many_matches_scalar_schedule() {
+    std::vector<double> large(100'000);
+    for (std::size_t index = 0; index < large.size(); ++index) {
+        large[index] = index % 11U == 0U ? 0.0 : static_cast<double>((index % 7U) + 1U);
+    }
+    const std::array<std::vector<double>, 4> tables{
+        std::vector<double>{1.0},
+        std::vector<double>{0.0, 1.0, 0.0, 7.0, 0.0, 2.0, 0.0},
+        std::vector<double>{std::numeric_limits<double>::denorm_min(), 0.0, 0.0},
+        large,
+    };
+    for (const auto& weights : tables) {
+        const std::array<Storm::PreparedWeightedIndex, 3> selectors{
+            Storm::PreparedWeightedIndex{weights},
+            Storm::PreparedWeightedIndex{weights, Storm::cumulative_layout::eytzinger},
+            Storm::PreparedWeightedIndex{weights, Storm::guide_table{weights.size()}},
+        };
+        for (const auto& prepared : selectors) {
+            for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{31},
+                                            std::size_t{32}, std::size_t{33},
+                                            std::size_t{1'000}}) {
+                Storm::engine_type scalar_engine{std::uint64_t{4'242}};
+                Storm::engine_type bulk_engine{std::uint64_t{4'242}};
+                std::vector<std::size_t> expected(count);
+                for (std::size_t& value : expected) {
+                    value = prepared(scalar_engine);
+                }
+                std::vector<std::size_t> actual(count, weights.size());
+                prepared.select_many(bulk_engine, std::span<std::size_t>{actual});
+                STORM_CHECK(actual == expected);
+                STORM_CHECK(bulk_engine == scalar_engine);
+            }
+        }
+    }
+}
+
 void test_zero_weights_are_never_selected() {
     const Storm::PreparedWeightedIndex prepared{{0.0, 1.0, 0.0, 4.0, 0.0}};
     Storm::engine_type engine{std::uint64_t{808}};
@@ -158,6 +233,8 @@ auto main() -> int {
     test_strict_cumulative_boundary();
     test_subnormal_endpoint_correction();
     test_reference_equivalence();
+    test_search_layout_equivalence();
+    test_select_many_matches_scalar_schedule();
     test_zero_weights_are_never_selected();
     return storm_test::finish();
 }
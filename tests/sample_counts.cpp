@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+auto binomial_pmf(const std::uint64_t trials, const double probability, const std::uint64_t k)
+    -> double {
+    const auto n = static_cast<double>(trials);
+    const auto x = static_cast<double>(k);
+    return std::exp(std::lgamma(n + 1.0) - std::lgamma(x + 1.0) - std::lgamma(n - x + 1.0) +
+                    x * std::log(probability) + (n - x) * std::log1p(-probability));
+}
+
+void test_binomial_degenerate_cases_consume_nothing() {
+    Storm::engine_type engine{std::uint64_t{17}};
+    const Storm::engine_type initial = engine;
+    STORM_CHECK(Storm::detail::binomial(engine, 0, 0.5) == 0U);
+    STORM_CHECK(Storm::detail::binomial(engine, 100, 0.0) == 0U);
+    STORM_CHECK(Storm::detail::binomial(engine, 100, 1.0) == 100U);
+    STORM_CHECK(engine == initial);
+}
+
+void test_binomial_matches_distribution() {
+    struct binomial_case {
+        std::uint64_t trials;
+        double probability;
+    };
+    // Covers inversion, BTRD, and the mirrored form of each.
+    constexpr std::array<binomial_case, 6> cases{{
+        {20, 0.1},
+        {7, 0.9},
+        {100, 0.3},
+        {50, 0.5},
+        {1'000, 0.7},
+        {40, 0.45},
+    }};
+    constexpr std::size_t samples = 200'000;
+    Storm::engine_type engine{std::uint64_t{0xB1'0009}};
+    for (const binomial_case& test_case : cases) {
+        std::vector<std::size_t> histogram(test_case.trials + 1);
+        for (std::size_t draw = 0; draw < samples; ++draw) {
+            const std::uint64_t value =
+                Storm::detail::binomial(engine, test_case.trials, test_case.probability);
+            STORM_CHECK(value <= test_case.trials);
+            ++histogram[std::min<std::uint64_t>(value, test_case.trials)];
+        }
+        double distance = 0.0;
+        for (std::uint64_t k = 0; k <= test_case.trials; ++k) {
+            const double observed =
+                static_cast<double>(histogram[k]) / static_cast<double>(samples);
+            distance += std::fabs(observed - binomial_pmf(test_case.trials,
+                                                          test_case.probability, k));
+        }
+        STORM_CHECK(distance / 2.0 < 0.01);
+    }
+}
+
+void test_binomial_large_trials() {
+    constexpr std::uint64_t trials = 4'000'000'000ULL;
+    constexpr double probability = 0.25;
+    constexpr std::size_t samples = 20'000;
+    Storm::engine_type engine{std::uint64_t{4}};
+    double sum = 0.0;
+    double squares = 0.0;
+    for (std::size_t draw = 0; draw < samples; ++draw) {
+        const auto value = static_cast<double>(Storm::detail::binomial(engine, trials, probability));
+        sum += value;
+        squares += value * value;
+    }
+    const double expected_mean = static_cast<double>(trials) * probability;
+    const double expected_variance = expected_mean * (1.0 - probability);
+    const double mean = sum / static_cast<double>(samples);
+    const double variance = squares / static_cast<double>(samples) - mean * mean;
+    STORM_CHECK(std::fabs(mean - expected_mean) <
+                5.0 * std::sqrt(expected_variance / static_cast<double>(samples)));
+    STORM_CHECK(std::fabs(variance / expected_variance - 1.0) < 0.05);
+}
+
+void test_counts_contract() {
+    const std::vector<double> weights{1.0, 0.0, 3.0, 6.0, 0.0, 10.0};
+    std::vector<double> cumulative(weights.size());
+    std::partial_sum(weights.begin(), weights.end(), cumulative.begin());
+    const Storm::PreparedWeightedIndex relative{weights};
+    const Storm::PreparedCumulativeWeightedIndex prepared_cumulative{cumulative};
+
+    Storm::engine_type engine{std::uint64_t{5}};
+    const Storm::engine_type initial = engine;
+    const auto empty = relative.sample_counts(engine, 0);
+    STORM_CHECK(empty == std::vector<std::uint64_t>(weights.size(), 0));
+    STORM_CHECK(engine == initial);
+
+    for (const std::uint64_t draws :
+         {std::uint64_t{1}, std::uint64_t{17}, std::uint64_t{1'000'000'000},
+          std::numeric_limits<std::uint64_t>::max()}) {
+        Storm::engine_type relative_engine{draws};
+        Storm::engine_type cumulative_engine{draws};
+        const auto counts = relative.sample_counts(relative_engine, draws);
+        STORM_CHECK(counts == prepared_cumulative.sample_counts(cumulative_engine, draws));
+        STORM_CHECK(relative_engine == cumulative_engine);
+        STORM_CHECK(counts.size() == weights.size());
+        STORM_CHECK(std::accumulate(counts.begin(), counts.end(), std::uint64_t{0}) == draws);
+        STORM_CHECK(counts[1] == 0U);
+        STORM_CHECK(counts[4] == 0U);
+    }
+
+    const Storm::PreparedWeightedIndex single{{0.0, 2.0, 0.0}};
+    STORM_CHECK(single.sample_counts(engine, 12) == (std::vector<std::uint64_t>{0, 12, 0}));
+}
+
+void test_counts_frequencies() {
+    constexpr std::array<double, 5> weights{1.0, 3.0, 0.0, 6.0, 10.0};
+    constexpr std::uint64_t draws = 1'000'000;
+    constexpr std::size_t repetitions = 200;
+    const Storm::PreparedWeightedIndex prepared{weights};
+    std::array<double, weights.size()> sums{};
+    Storm::engine_type engine{std::uint64_t{9'876'543}};
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition) {
+        const auto counts = prepared.sample_counts(engine, draws);
+        for (std::size_t index = 0; index < counts.size(); ++index) {
+            sums[index] += static_cast<double>(counts[index]);
+        }
+    }
+    const double samples = static_cast<double>(draws) * static_cast<double>(repetitions);
+    for (std::size_t index = 0; index < weights.size(); ++index) {
+        STORM_CHECK(std::fabs(sums[index] / samples - weights[index] / 20.0) <= 1e-3);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_binomial_degenerate_cases_consume_nothing();
+    test_binomial_matches_distribution();
+    test_binomial_large_trials();
+    test_counts_contract();
+    test_counts_frequencies();
+    return storm_test::finish();
+}
@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr auto orders = std::array{Storm::sample_order::sorted, Storm::sample_order::random};
+
+auto sample(Storm::engine_type& engine,
+            const std::size_t size,
+            const std::size_t count,
+            const Storm::sample_order order) -> std::vector<std::size_t> {
+    std::vector<std::size_t> output(count);
+    Storm::sample_indices(engine, size, count, output, order);
+    return output;
+}
+
+auto distinct_and_in_range(std::vector<std::size_t> values, const std::size_t size) -> bool {
+    std::ranges::sort(values);
+    return std::ranges::adjacent_find(values) == values.end() &&
+           (values.empty() || values.back() < size);
+}
+
+void test_invalid_arguments() {
+    Storm::engine_type engine{std::uint64_t{1}};
+    const Storm::engine_type initial_state = engine;
+    std::vector<std::size_t> output(4);
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::sample_indices(engine, 3, 4, output));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::sample_indices(engine, 10, 5, output));
+    STORM_EXPECT_THROWS(std::invalid_argument,
+                        Storm::sample_indices(engine, 10, 5, output, Storm::sample_order::random));
+    STORM_CHECK(engine == initial_state);
+
+    output.assign(4, 99);
+    Storm::sample_indices(engine, 0, 0, output);
+    Storm::sample_indices(engine, 10, 0, output, Storm::sample_order::random);
+    STORM_CHECK(engine == initial_state);
+    STORM_CHECK(std::ranges::all_of(output, [](const std::size_t value) { return value == 99; }));
+
+    Storm::sample_indices(engine, 10, 2, output);
+    STORM_CHECK(output[0] < output[1] && output[1] < 10 && output[2] == 99);
+    Storm::seed(4);
+    Storm::sample_indices(10, 3, output, Storm::sample_order::random);
+    STORM_CHECK(distinct_and_in_range({output.begin(), output.begin() + 3}, 10));
+}
+
+void test_valid_samples() {
+    Storm::engine_type engine{std::uint64_t{0x5A3F1E}};
+    for (const auto order : orders) {
+        for (const auto& [size, count] : std::array<std::array<std::size_t, 2>, 9>{{
+                 {1, 1}, {2, 1}, {2, 2}, {10, 10}, {100, 7}, {100, 50},
+                 {1'000'000, 3}, {1'000'000, 10'000}, {1'000'000, 999'999}}}) {
+            for (std::size_t repeat = 0; repeat < 5; ++repeat) {
+                const auto values = sample(engine, size, count, order);
+                STORM_CHECK(distinct_and_in_range(values, size));
+                if (order == Storm::sample_order::sorted) {
+                    STORM_CHECK(std::ranges::is_sorted(values));
+                }
+            }
+        }
+    }
+
+    // Sorted sampling keeps constant memory for populations far beyond RAM.
+    constexpr std::size_t huge = std::size_t{1} << 52U;
+    const auto values = sample(engine, huge, 1'000, Storm::sample_order::sorted);
+    STORM_CHECK(distinct_and_in_range(values, huge));
+    STORM_CHECK(std::ranges::is_sorted(values));
+    STORM_CHECK(values.back() > huge / 2);
+}
+
+void test_reproducible() {
+    for (const auto order : orders) {
+        Storm::engine_type first{std::uint64_t{31}};
+        Storm::engine_type second{std::uint64_t{31}};
+        STORM_CHECK(sample(first, 50'000, 300, order) == sample(second, 50'000, 300, order));
+        STORM_CHECK(first == second);
+    }
+}
+
+// Floyd's candidates draw exactly as uniform_index would, before the shuffle.
+void test_floyd_schedule() {
+    Storm::engine_type actual_engine{std::uint64_t{808}};
+    Storm::engine_type reference_engine = actual_engine;
+    std::vector<std::size_t> actual(6);
+    Storm::detail::sample_floyd(actual_engine, 20, std::span{actual});
+    std::vector<std::size_t> expected;
+    for (std::size_t candidate = 14; candidate < 20; ++candidate) {
+        const std::size_t drawn = Storm::uniform_index(reference_engine, candidate + 1);
+        expected.push_back(std::ranges::find(expected, drawn) == expected.end() ? drawn
+                                                                                : candidate);
+    }
+    STORM_CHECK(actual == expected);
+    STORM_CHECK(actual_engine == reference_engine);
+}
+
+// A loose chi-square bound: the degrees of freedom plus eight standard deviations.
+auto chi_square_limit(const std::size_t cells) -> double {
+    const auto freedom = static_cast<double>(cells - 1);
+    return freedom + (8.0 * std::sqrt(2.0 * freedom)) + 10.0;
+}
+
+// Every index should appear equally often, every 2-subset of a small
+// population should be equally likely, and random order should put each
+// index in each output slot equally often. Size 1000 with five draws stays
+// on the skip-generating path; the other two fall back to the sequential scan.
+void test_uniformity() {
+    for (const auto order : orders) {
+        for (const auto& [size, count] : std::array<std::array<std::size_t, 2>, 3>{{
+                 {6, 2}, {200, 20}, {1'000, 5}}}) {
+            constexpr std::size_t trials = 60'000;
+            Storm::engine_type engine{std::uint64_t{size}};
+            std::vector<std::size_t> index_counts(size);
+            std::vector<std::size_t> pair_counts(size * size);
+            std::vector<std::size_t> first_slot(size);
+            for (std::size_t trial = 0; trial < trials; ++trial) {
+                const auto values = sample(engine, size, count, order);
+                for (const std::size_t value : values) {
+                    ++index_counts[value];
+                }
+                ++pair_counts[(std::min(values[0], values[1]) * size) +
+                              std::max(values[0], values[1])];
+                ++first_slot[values[0]];
+            }
+            const double per_index =
+                static_cast<double>(trials * count) / static_cast<double>(size);
+            double chi_square = 0.0;
+            for (const std::size_t observed : index_counts) {
+                const double difference = static_cast<double>(observed) - per_index;
+                chi_square += difference * difference / per_index;
+            }
+            STORM_CHECK(chi_square < chi_square_limit(size));
+            if (size == 6) {
+                constexpr double per_pair = trials / 15.0;
+                for (std::size_t low = 0; low < size; ++low) {
+                    for (std::size_t high = low + 1; high < size; ++high) {
+                        const double observed =
+                            static_cast<double>(pair_counts[(low * size) + high]);
+                        STORM_CHECK(std::fabs(observed - per_pair) <= per_pair * 0.08);
+                    }
+                }
+            }
+            if (order == Storm::sample_order::random) {
+                const double per_slot = static_cast<double>(trials) / static_cast<double>(size);
+                double slot_chi_square = 0.0;
+                for (const std::size_t observed : first_slot) {
+                    const double difference = static_cast<double>(observed) - per_slot;
+                    slot_chi_square += difference * difference / per_slot;
+                }
+                STORM_CHECK(slot_chi_square < chi_square_limit(size));
+            }
+        }
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_invalid_arguments();
+    test_valid_samples();
+    test_reproducible();
+    test_floyd_schedule();
+    test_uniformity();
+    return storm_test::finish();
+}
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template<typename Range>
+concept storm_shufflable = requires(Storm::engine_type& engine, Range& range) {
+    Storm::shuffle(engine, range);
+};
+
+auto iota_vector(const std::size_t size) -> std::vector<std::size_t> {
+    std::vector<std::size_t> values(size);
+    std::iota(values.begin(), values.end(), std::size_t{0});
+    return values;
+}
+
+// The documented schedule written as one uniform_index call per position.
+auto reference_shuffle(Storm::engine_type& engine, std::vector<std::size_t> values)
+    -> std::vector<std::size_t> {
+    for (std::size_t position = values.size(); position > 1; --position) {
+        const std::size_t other = Storm::uniform_index(engine, position);
+        std::swap(values[position - 1], values[other]);
+    }
+    return values;
+}
+
+void test_api() {
+    static_assert(storm_shufflable<std::vector<int>>);
+    static_assert(storm_shufflable<std::array<double, 4>>);
+    static_assert(storm_shufflable<std::deque<int>>);
+    static_assert(!storm_shufflable<std::list<int>>);
+    static_assert(!storm_shufflable<const std::vector<int>>);
+
+    Storm::engine_type engine{std::uint64_t{8}};
+    const Storm::engine_type initial_state = engine;
+    std::vector<int> empty;
+    Storm::shuffle(engine, empty);
+    std::array<int, 1> single{7};
+    Storm::shuffle(engine, single);
+    Storm::shuffle(engine, single, Storm::nearly_divisionless_mapping);
+    STORM_CHECK(engine == initial_state);
+    STORM_CHECK(single[0] == 7);
+
+    std::vector<int> values{1, 2, 3, 4, 5};
+    Storm::seed(3);
+    Storm::shuffle(values);
+    Storm::shuffle(std::span{values}.subspan(1), Storm::nearly_divisionless_mapping);
+    std::ranges::sort(values);
+    STORM_CHECK((values == std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+void test_default_schedule() {
+    for (const std::size_t size :
+         {std::size_t{2}, std::size_t{3}, std::size_t{10}, std::size_t{1'000}}) {
+        Storm::engine_type actual_engine{static_cast<std::uint64_t>(size)};
+        Storm::engine_type reference_engine = actual_engine;
+        auto actual = iota_vector(size);
+        Storm::shuffle(actual_engine, actual);
+        STORM_CHECK(actual == reference_shuffle(reference_engine, iota_vector(size)));
+        STORM_CHECK(actual_engine == reference_engine);
+    }
+
+    // Both schedules use only Storm-owned arithmetic, so these hold on every
+    // standard library.
+    Storm::engine_type engine{std::uint64_t{2026}};
+    auto values = iota_vector(10);
+    Storm::shuffle(engine, values);
+    STORM_CHECK((values == std::vector<std::size_t>{4, 5, 3, 8, 7, 2, 0, 9, 6, 1}));
+    engine.seed(2026);
+    values = iota_vector(10);
+    Storm::shuffle(engine, values, Storm::nearly_divisionless_mapping);
+    STORM_CHECK((values == std::vector<std::size_t>{6, 9, 5, 2, 0, 8, 7, 4, 1, 3}));
+}
+
+void test_batched_schedule_is_a_permutation() {
+    for (const std::size_t size : {std::size_t{2}, std::size_t{3}, std::size_t{7},
+                                   std::size_t{513}, std::size_t{20'000}, std::size_t{600'000}}) {
+        Storm::engine_type engine{static_cast<std::uint64_t>(size)};
+        auto values = iota_vector(size);
+        Storm::shuffle(engine, values, Storm::nearly_divisionless_mapping);
+        STORM_CHECK(values != iota_vector(size) || size < 3);
+        std::ranges::sort(values);
+        STORM_CHECK(values == iota_vector(size));
+    }
+
+    Storm::engine_type first_engine{std::uint64_t{99}};
+    Storm::engine_type second_engine{std::uint64_t{99}};
+    auto first = iota_vector(5'000);
+    auto second = iota_vector(5'000);
+    Storm::shuffle(first_engine, first, Storm::nearly_divisionless_mapping);
+    Storm::shuffle(second_engine, second, Storm::nearly_divisionless_mapping);
+    STORM_CHECK(first == second);
+    STORM_CHECK(first_engine == second_engine);
+}
+
+// Every order of four elements should be equally likely, and so should every
+// position of a value.
+template<typename Mapping>
+void check_uniformity(const Mapping mapping) {
+    constexpr std::size_t trials = 240'000;
+    std::array<std::size_t, 24> orders{};
+    Storm::engine_type engine{std::uint64_t{0x5E1F}};
+    for (std::size_t trial = 0; trial < trials; ++trial) {
+        std::array<std::size_t, 4> values{0, 1, 2, 3};
+        Storm::shuffle(engine, values, mapping);
+        std::size_t rank = 0;
+        for (std::size_t position = 0; position < values.size(); ++position) {
+            const auto smaller_after = static_cast<std::size_t>(std::count_if(
+                values.begin() + static_cast<std::ptrdiff_t>(position) + 1,
+                values.end(),
+                [&values, position](const std::size_t value) { return value < values[position]; }));
+            rank = (rank * (values.size() - position)) + smaller_after;
+        }
+        ++orders[rank];
+    }
+    constexpr double expected = trials / 24.0;
+    for (const std::size_t count : orders) {
+        STORM_CHECK(std::fabs(static_cast<double>(count) - expected) <= expected * 0.05);
+    }
+
+    // Where the values below 100 land in a length crossing the batch limits.
+    constexpr std::size_t size = 600;
+    constexpr std::size_t rounds = 2'000;
+    std::vector<std::size_t> positions(size);
+    for (std::size_t round = 0; round < rounds; ++round) {
+        auto values = iota_vector(size);
+        Storm::shuffle(engine, values, mapping);
+        for (std::size_t position = 0; position < size; ++position) {
+            if (values[position] < 100) {
+                ++positions[position];
+            }
+        }
+    }
+    const double per_position = (rounds * 100.0) / size;
+    double chi_square = 0.0;
+    for (const std::size_t count : positions) {
+        const double difference = static_cast<double>(count) - per_position;
+        chi_square += difference * difference / per_position;
+    }
+    // 599 degrees of freedom; the 1e-6 upper tail is near 770.
+    STORM_CHECK(chi_square < 770.0);
+}
+
+void test_uniformity() {
+    check_uniformity(Storm::modulo_mapping);
+    check_uniformity(Storm::nearly_divisionless_mapping);
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_api();
+    test_default_schedule();
+    test_batched_schedule_is_a_permutation();
+    test_uniformity();
+    return storm_test::finish();
+}
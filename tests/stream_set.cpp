@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: MIT
+#include <Storm/Storm.hpp>
+
+#include "test_harness.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr std::uint64_t master_seed = 0x0123'4567'89AB'CDEFULL;
+constexpr std::size_t stream_count = 64;
+constexpr std::size_t draws_per_stream = 100;
+
+auto draw_streams(const std::size_t threads) -> std::vector<std::uint64_t> {
+    Storm::StreamSet streams{master_seed, stream_count};
+    std::vector<std::uint64_t> values(stream_count * draws_per_stream);
+    std::vector<std::thread> workers;
+    for (std::size_t worker = 0; worker < threads; ++worker) {
+        workers.emplace_back([&streams, &values, threads, worker] {
+            for (std::size_t stream = worker; stream < stream_count; stream += threads) {
+                for (std::size_t draw = 0; draw < draws_per_stream; ++draw) {
+                    values[(stream * draws_per_stream) + draw] =
+                        Storm::uniform_index(streams[stream], std::size_t{1'000'000});
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return values;
+}
+
+void test_documented_derivation() {
+    Storm::StreamSet streams{master_seed, 3};
+    STORM_CHECK(streams.size() == 3U);
+    STORM_CHECK(streams.master_seed() == master_seed);
+    for (std::size_t stream = 0; stream < streams.size(); ++stream) {
+        std::seed_seq sequence{0x89AB'CDEFU, 0x0123'4567U, static_cast<std::uint32_t>(stream), 0U};
+        Storm::engine_type expected{sequence};
+        STORM_CHECK(streams[stream] == expected);
+    }
+}
+
+void test_thread_count_invariance() {
+    const auto expected = draw_streams(1);
+    for (const std::size_t threads : {std::size_t{2}, std::size_t{3}, std::size_t{8}}) {
+        STORM_CHECK(draw_streams(threads) == expected);
+    }
+}
+
+void test_access_order_does_not_matter() {
+    Storm::StreamSet forward{7, 10};
+    Storm::StreamSet backward{7, 10};
+    std::vector<std::uint64_t> forward_values(10);
+    std::vector<std::uint64_t> backward_values(10);
+    for (std::size_t stream = 0; stream < 10; ++stream) {
+        forward_values[stream] = forward[stream]();
+    }
+    for (std::size_t stream = 10; stream-- > 0;) {
+        backward_values[stream] = backward[stream]();
+    }
+    STORM_CHECK(forward_values == backward_values);
+    STORM_CHECK(forward_values[0] != forward_values[1]);
+}
+
+void test_lazy_padded_storage() {
+    Storm::StreamSet streams{1, 100'000};
+    Storm::engine_type& last = streams[99'999];
+    Storm::engine_type& first = streams.at(0);
+    STORM_CHECK(&streams[99'999] == &last);
+    STORM_CHECK(reinterpret_cast<std::uintptr_t>(&first) % Storm::detail::cache_line_size == 0U);
+    STORM_CHECK(reinterpret_cast<std::uintptr_t>(&last) % Storm::detail::cache_line_size == 0U);
+    const auto first_value = first();
+    Storm::StreamSet again{1, 100'000};
+    STORM_CHECK(again[0]() == first_value);
+    STORM_EXPECT_THROWS(std::out_of_range, static_cast<void>(streams.at(100'000)));
+    static_assert(!std::is_copy_constructible_v<Storm::StreamSet>);
+    static_assert(std::is_nothrow_move_constructible_v<Storm::StreamSet>);
+}
+
+void test_other_engines() {
+    Storm::BasicStreamSet<Storm::xoshiro256pp> fast{5, 4};
+    Storm::BasicStreamSet<Storm::philox4x64> counter{5, 4};
+    STORM_CHECK(fast[0]() != fast[1]());
+    STORM_CHECK(counter[2].stream() != counter[3].stream());
+    STORM_CHECK(Storm::canonical(fast[3]) < 1.0);
+    STORM_CHECK(Storm::uniform_index(counter[0], std::size_t{10}) < 10U);
+}
+
+}  // namespace
+
+auto main() -> int {
+    test_documented_derivation();
+    test_thread_count_invariance();
+    test_access_order_does_not_matter();
+    test_lazy_padded_storage();
+    test_other_engines();
+    return storm_test::finish();
+}
@@ -192,6 +192,178 @@ void test_broad_marginal_uniformity() {
     }
 }
 
+void test_compact_permutation_storage() {
+    for (const std::size_t size : {std::size_t{1}, std::size_t{1'000}, std::size_t{65'536}}) {
+        Storm::engine_type engine{std::uint64_t{size}};
+        const Storm::detail::wide_permutation permutation{engine, size, "test"};
+        STORM_CHECK(permutation.size() == size);
+        STORM_CHECK(permutation.index_size() == sizeof(std::uint16_t));
+    }
+
+    constexpr std::size_t size = 70'000;
+    Storm::engine_type narrow_engine{std::uint64_t{0x5107'A6E}};
+    Storm::engine_type wide_engine = narrow_engine;
+    const Storm::detail::wide_permutation narrow{narrow_engine, size, "test"};
+    const auto wide = Storm::detail::make_wide_permutation<std::size_t>(wide_engine, size);
+    STORM_CHECK(narrow.index_size() == sizeof(std::uint32_t));
+    STORM_CHECK(narrow_engine == wide_engine);
+    bool same = true;
+    for (std::size_t position = 0; position < size; ++position) {
+        same = narrow[position] == wide[position] && same;
+    }
+    STORM_CHECK(same);
+
+    Storm::engine_type actual_engine{std::uint64_t{0x5107'A6E}};
+    Storm::engine_type reference_engine = actual_engine;
+    Storm::wide_index_selector actual{actual_engine, size};
+    fortuna_6_0_2_wide_index_reference reference{reference_engine, size};
+    for (std::size_t draw = 0; draw < 1'000; ++draw) {
+        STORM_CHECK(actual(actual_engine) == reference(reference_engine));
+    }
+    STORM_CHECK(actual_engine == reference_engine);
+}
+
+void test_batched_construction_matches_scalar_schedule() {
+    constexpr std::array<std::uint64_t, 6> bounds{
+        2, 3, 1'000, 0x1'0000'0001ULL, 0x8000'0000'0000'0001ULL, 0xFFFF'FFFF'FFFF'FFFFULL};
+    for (const std::uint64_t bound : bounds) {
+        Storm::engine_type deferred_engine{bound};
+        Storm::engine_type eager_engine{bound};
+        for (std::size_t draw = 0; draw < 1'000; ++draw) {
+            STORM_CHECK(Storm::detail::bounded_deferred(deferred_engine, bound) ==
+                        Storm::detail::bounded(eager_engine, bound));
+        }
+        STORM_CHECK(deferred_engine == eager_engine);
+    }
+
+    constexpr std::size_t batch = Storm::detail::wide_permutation_batch;
+    for (const std::size_t size :
+         {batch, batch + 1, batch + 2, (2 * batch) + 1, std::size_t{999}}) {
+        Storm::engine_type actual_engine{static_cast<std::uint64_t>(size)};
+        Storm::engine_type reference_engine = actual_engine;
+        Storm::wide_index_selector actual{actual_engine, size};
+        fortuna_6_0_2_wide_index_reference reference{reference_engine, size};
+        STORM_CHECK(actual_engine == reference_engine);
+        for (std::size_t draw = 0; draw < size; ++draw) {
+            STORM_CHECK(actual(actual_engine) == reference(reference_engine));
+        }
+    }
+}
+
+void test_select_many_matches_repeated_calls() {
+    for (const std::size_t size :
+         {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{100}, std::size_t{70'000}}) {
+        Storm::engine_type batch_engine{static_cast<std::uint64_t>(size) + 11};
+        Storm::engine_type scalar_engine = batch_engine;
+        Storm::wide_index_selector batch{batch_engine, size};
+        Storm::wide_index_selector scalar{scalar_engine, size};
+        for (const std::size_t count :
+             {std::size_t{0}, std::size_t{1}, std::size_t{16}, std::size_t{1'024}}) {
+            std::vector<std::size_t> output(count);
+            batch.select_many(batch_engine, output);
+            for (const std::size_t selected : output) {
+                STORM_CHECK(selected == scalar(scalar_engine));
+            }
+            STORM_CHECK(batch_engine == scalar_engine);
+        }
+        STORM_CHECK(batch(batch_engine) == scalar(scalar_engine));
+    }
+}
+
+auto is_permutation_of_size(const Storm::detail::wide_permutation& permutation) -> bool {
+    std::vector<bool> seen(permutation.size());
+    for (std::size_t position = 0; position < permutation.size(); ++position) {
+        const std::size_t index = permutation[position];
+        if (index >= seen.size() || seen[index]) {
+            return false;
+        }
+        seen[index] = true;
+    }
+    return true;
+}
+
+void test_insert_and_remove_keep_a_permutation() {
+    Storm::engine_type engine{std::uint64_t{0x1A5E'27}};
+    Storm::detail::wide_permutation permutation{engine, 65'536, "test"};
+    STORM_CHECK(permutation.index_size() == sizeof(std::uint16_t));
+    const Storm::detail::wide_permutation before = permutation;
+    const std::size_t position = permutation.insert(engine);
+    STORM_CHECK(permutation.size() == 65'537U);
+    STORM_CHECK(permutation.index_size() == sizeof(std::uint32_t));
+    STORM_CHECK(permutation[position] == 65'536U);
+    if (position != 65'536U) {
+        STORM_CHECK(permutation[65'536] == before[position]);
+    }
+    STORM_CHECK(is_permutation_of_size(permutation));
+
+    for (std::size_t step = 0; step < 2'000; ++step) {
+        if (Storm::uniform_index(engine, std::size_t{2}) == 0) {
+            static_cast<void>(permutation.insert(engine));
+        } else {
+            static_cast<void>(
+                permutation.remove(Storm::uniform_index(engine, permutation.size())));
+        }
+    }
+    STORM_CHECK(is_permutation_of_size(permutation));
+
+    // Two inserts into a one-entry permutation give every order of three.
+    std::array<std::size_t, 6> orders{};
+    constexpr std::size_t trials = 60'000;
+    for (std::size_t trial = 0; trial < trials; ++trial) {
+        Storm::engine_type trial_engine{static_cast<std::uint64_t>(trial)};
+        Storm::detail::wide_permutation small{trial_engine, 1, "test"};
+        static_cast<void>(small.insert(trial_engine));
+        static_cast<void>(small.insert(trial_engine));
+        ++orders[(small[0] * 2) + (small[1] > small[2] ? 1 : 0)];
+    }
+    for (const std::size_t count : orders) {
+        STORM_CHECK(std::fabs(static_cast<double>(count) - (trials / 6.0)) <= trials * 0.01);
+    }
+}
+
+void test_mutable_population() {
+    Storm::engine_type engine{std::uint64_t{0xCA7A'1065}};
+    Storm::wide_index_selector selector{engine, std::size_t{1}};
+    const Storm::engine_type before_errors = engine;
+    STORM_EXPECT_THROWS(std::invalid_argument, selector.remove(0));
+    STORM_EXPECT_THROWS(std::out_of_range, selector.remove(1));
+    STORM_CHECK(engine == before_errors);
+    STORM_CHECK(selector.size() == 1U);
+
+    std::size_t previous = std::numeric_limits<std::size_t>::max();
+    for (std::size_t step = 0; step < 200'000; ++step) {
+        const std::size_t size = selector.size();
+        const std::size_t action = Storm::uniform_index(engine, std::size_t{8});
+        if (action == 0 && size < 5'000) {
+            STORM_CHECK(selector.insert(engine) == size);
+            STORM_CHECK(selector.size() == size + 1);
+        } else if (action == 1 && size > 1) {
+            const std::size_t removed = Storm::uniform_index(engine, size);
+            selector.remove(removed);
+            STORM_CHECK(selector.size() == size - 1);
+            if (previous == removed) {
+                previous = std::numeric_limits<std::size_t>::max();
+            } else if (previous == size - 1) {
+                previous = removed;
+            }
+        } else {
+            const std::size_t selected = selector(engine);
+            STORM_CHECK(selected < size);
+            if (size > 1) {
+                STORM_CHECK(selected != previous);
+            }
+            previous = selected;
+        }
+    }
+
+    // After growth from one entry, every index is still reachable.
+    std::vector<bool> seen(selector.size());
+    for (std::size_t draw = 0; draw < selector.size() * 200; ++draw) {
+        seen[selector(engine)] = true;
+    }
+    STORM_CHECK(std::ranges::all_of(seen, [](const bool value) { return value; }));
+}
+
 }  // namespace
 
 auto main() -> int {
@@ -200,5 +372,10 @@ auto main() -> int {
     test_reference_equivalence();
     test_bounds_coverage_and_no_immediate_repeat();
     test_broad_marginal_uniformity();
+    test_compact_permutation_storage();
+    test_batched_construction_matches_scalar_schedule();
+    test_select_many_matches_repeated_calls();
+    test_insert_and_remove_keep_a_permutation();
+    test_mutable_population();
     return storm_test::finish();
 }